@@ -0,0 +1,152 @@
+/*!
+	@file examples/misc_test/frame_scheduler_test/main.cpp
+	@author Gavin Lyons
+	@brief Test file for frame_scheduler TE (tearing effect) synchronised flushes,
+		no display needed. A thread plays the controller TE output with signalTearEdge(),
+		the flush function only records when it ran, results to console.
+	Project Name: Display_Lib_RPI
+	@test
+		-# Test 1100 Each flush starts on a TE edge that came after presentFrame was called
+		-# Test 1101 TE edges stop, flush still runs after at most one frame period
+		-# Test 1102 Caller falls behind, missed frame slots are skipped not burst
+*/
+
+#include <atomic>
+#include <thread>
+#include "frame_scheduler_RDL.hpp"
+
+/// @cond
+
+// Settings
+const uint16_t TARGET_FPS = 30;       // scheduler frame rate
+const uint32_t TE_PERIOD_US = 16667;  // simulated panel refresh, 60Hz
+const uint16_t FRAMES = 30;           // frames presented by Test 1100
+
+// Simulated TE source
+std::atomic<uint32_t> teEdges{0};     // edges signalled so far
+std::atomic<bool> teRunning{false};   // TE thread ticks while set
+uint32_t edgesAtFlush = 0;            // teEdges seen by the last flush
+uint32_t flushCount = 0;              // flushes run
+
+// =============== Function prototype ================
+void TearThread(frame_scheduler& scheduler);
+bool Test1100(frame_scheduler& scheduler);
+bool Test1101(frame_scheduler& scheduler);
+bool Test1102(frame_scheduler& scheduler);
+
+// ======================= Main ===================
+int main(void)
+{
+	printf("Frame scheduler Test Begin\n\n");
+	// Flush function touches no hardware, it records the TE edge count it ran at
+	frame_scheduler scheduler([]() -> rdlib::Return_Codes_e
+	{
+		edgesAtFlush = teEdges.load();
+		flushCount++;
+		return rdlib::Success;
+	}, TARGET_FPS);
+	scheduler.TearSyncSimulatedBegin();
+
+	teRunning = true;
+	std::thread teThread(TearThread, std::ref(scheduler));
+	bool result1100 = Test1100(scheduler);
+	teRunning = false;
+	teThread.join();
+	bool result1101 = Test1101(scheduler);
+	bool result1102 = Test1102(scheduler);
+	scheduler.TearSyncEnd();
+
+	bool ErrorFlag = result1100 && result1101 && result1102;
+	printf("=== Final Test Summary ===\n");
+	printf("Test1100 TE ordering result   : %s\n", result1100 ? "PASS" : "FAIL");
+	printf("Test1101 TE timeout result    : %s\n", result1101 ? "PASS" : "FAIL");
+	printf("Test1102 Frame skip result    : %s\n", result1102 ? "PASS" : "FAIL");
+	printf("Overall Test result scheduler : %s\n\n", ErrorFlag ? "PASS" : "FAIL");
+	return ErrorFlag ? 0 : -1;
+}
+
+// ======================= Functions ===================
+
+// Plays the controller TE output, one edge per panel refresh
+void TearThread(frame_scheduler& scheduler)
+{
+	auto nextEdge = frame_scheduler::FrameClock_t::now();
+	while (teRunning)
+	{
+		nextEdge += std::chrono::microseconds(TE_PERIOD_US);
+		std::this_thread::sleep_until(nextEdge);
+		teEdges++; // counted before the scheduler is woken
+		scheduler.signalTearEdge();
+	}
+}
+
+// Test 1100 every flush follows a TE edge newer than its presentFrame call, one flush per frame slot
+bool Test1100(frame_scheduler& scheduler)
+{
+	printf("Test 1100 : TE ordering, %u frames at %u fps, TE %u uS\n", FRAMES, TARGET_FPS, TE_PERIOD_US);
+	bool pass = true;
+	uint32_t lastEdges = 0;
+	scheduler.restartClock();
+	scheduler.resetFrameStats();
+	auto start = frame_scheduler::FrameClock_t::now();
+	for (uint16_t frame = 0; frame < FRAMES; frame++)
+	{
+		uint32_t edgesBefore = teEdges.load();
+		scheduler.presentFrame();
+		if (edgesAtFlush <= edgesBefore)
+		{
+			printf("Frame %u flushed before a new TE edge : edges %u -> %u\n", frame, edgesBefore, edgesAtFlush);
+			pass = false;
+		}
+		if (frame > 0 && edgesAtFlush == lastEdges)
+		{
+			printf("Frame %u flushed on the same TE edge as the frame before\n", frame);
+			pass = false;
+		}
+		lastEdges = edgesAtFlush;
+	}
+	auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(frame_scheduler::FrameClock_t::now() - start).count();
+	frame_scheduler::FrameStats_t stats = scheduler.getFrameStats();
+	// first frame is at once, the rest one period apart, plus up to one TE period of wait
+	long long expectMs = (FRAMES - 1) * 1000LL / TARGET_FPS;
+	printf("Elapsed %lld mS, expected %lld mS, presented %u, TE timeouts %u\n",
+		static_cast<long long>(elapsedMs), expectMs, stats.framesPresented, stats.tearTimeouts);
+	if (stats.framesPresented != FRAMES || stats.tearTimeouts != 0) pass = false;
+	if (elapsedMs < expectMs || elapsedMs > expectMs + 2 * (TE_PERIOD_US / 1000) + 20) pass = false;
+	return pass;
+}
+
+// Test 1101 no TE edges, each presentFrame still flushes, counted as a TE timeout
+bool Test1101(frame_scheduler& scheduler)
+{
+	printf("Test 1101 : TE source stopped\n");
+	scheduler.restartClock();
+	scheduler.resetFrameStats();
+	uint32_t flushesBefore = flushCount;
+	auto start = frame_scheduler::FrameClock_t::now();
+	scheduler.presentFrame();
+	auto elapsedMs = std::chrono::duration_cast<std::chrono::milliseconds>(frame_scheduler::FrameClock_t::now() - start).count();
+	frame_scheduler::FrameStats_t stats = scheduler.getFrameStats();
+	printf("Waited %lld mS, TE timeouts %u\n", static_cast<long long>(elapsedMs), stats.tearTimeouts);
+	return flushCount == flushesBefore + 1 && stats.tearTimeouts == 1 && elapsedMs <= 1000 / TARGET_FPS + 20;
+}
+
+// Test 1102 caller is three periods late, the missed slots are skipped
+bool Test1102(frame_scheduler& scheduler)
+{
+	printf("Test 1102 : Frame skip, TE off\n");
+	scheduler.TearSyncEnd();
+	scheduler.restartClock();
+	scheduler.resetFrameStats();
+	scheduler.presentFrame();
+	std::this_thread::sleep_for(std::chrono::milliseconds(3 * 1000 / TARGET_FPS + 5));
+	scheduler.presentFrame();
+	scheduler.presentFrame();
+	frame_scheduler::FrameStats_t stats = scheduler.getFrameStats();
+	printf("Presented %u, skipped %u, missed deadlines %u\n", stats.framesPresented, stats.framesSkipped, stats.missedDeadlines);
+	return stats.framesPresented == 3 && stats.framesSkipped >= 2 && stats.missedDeadlines == 1;
+}
+
+// ============== EOF =========
+
+/// @endcond
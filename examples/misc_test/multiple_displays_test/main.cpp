@@ -48,6 +48,9 @@ int SPI_FLAGS = 0; // last 2 LSB bits define SPI mode, see readme, mode 0 for th
  // instantiate the objects
 ST7735_TFT myTFT;
 ERMCH1115 myOLED(MY_OLED_WIDTH ,MY_OLED_HEIGHT, RES, DC);
+// Both displays share SPI device 0, the arbiter serializes their transactions
+// so each display can be driven from its own thread.
+spi_bus_arbiter mySPIBus;
 
 //  Section ::  Function Headers 
 
@@ -92,6 +95,7 @@ uint8_t SetupLCDSPI(void)
 		return 3;
 	}
 //*****************************
+	myTFT.SPIBusAttach(mySPIBus);
 	delayMilliSecRDL(50);
 	return 0;
 }
@@ -104,6 +108,7 @@ uint8_t  SetupOLEDSPI(void)
 		std::cout << "Error 1202: Setup : Cannot start spi" << std::endl;
 		return -1;
 	}
+	myOLED.SPIBusAttach(mySPIBus);
 	delayMilliSecRDL(50);
 	myOLED.OLEDFillScreen(0x0F); //splash screen bars
 	delayMilliSecRDL(1500);
@@ -0,0 +1,84 @@
+/*!
+	@file examples/misc_test/print_benchmark/main.cpp
+	@author Gavin Lyons
+	@brief Benchmark of the Print class number formatting, no display needed.
+		Prints numbers to a memory sink and reports the cost and heap allocations per call.
+		Build it against two library versions to compare them.
+	Project Name: Display_Lib_RPI
+	@test
+		-# Test 1110 Cost per call of print for integers, floats, vectors
+*/
+
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include "print_data_RDL.hpp"
+
+/// @cond
+
+// Settings
+const int CALLS = 200000; // calls timed per case
+
+// Heap allocation counter, every operator new of the program is counted
+static size_t allocCount = 0;
+void* operator new(size_t size)
+{
+	allocCount++;
+	void* ptr = malloc(size == 0 ? 1 : size);
+	if (ptr == nullptr) throw std::bad_alloc();
+	return ptr;
+}
+void operator delete(void* ptr) noexcept {free(ptr);}
+void operator delete(void* ptr, size_t) noexcept {free(ptr);}
+
+// Memory sink, one virtual write per byte as a display's Print does
+class PrintSink : public Print {
+public:
+	std::string out;
+	size_t write(uint8_t character) override { out.push_back(static_cast<char>(character)); return 1; }
+	using Print::write;
+};
+
+// =============== Function prototype ================
+template <typename Func_T> void Benchmark(const char* name, Func_T func);
+
+// ======================= Main ===================
+int main(void)
+{
+	printf("Test 1110 : Print number formatting, %d calls per case\n", CALLS);
+	printf("%-24s %10s %14s\n", "case", "ns/call", "allocs/call");
+	Benchmark("print(double,2)", [](PrintSink& sink, int i) { sink.print(i * 0.37 - 1000.0, 2); });
+	Benchmark("print(double,5)", [](PrintSink& sink, int i) { sink.print(i * 1.37e-3, 5); });
+	Benchmark("print(long,DEC)", [](PrintSink& sink, int i) { sink.print(static_cast<long>(i) * 7919 - 50000); });
+	Benchmark("print(long,HEX)", [](PrintSink& sink, int i) { sink.print(static_cast<long>(i) * 7919, Print::RDL_HEX); });
+	Benchmark("print(int,BIN)", [](PrintSink& sink, int i) { sink.print(i, Print::RDL_BIN); });
+	const std::vector<float> floats{1.25f, -3.5f, 100.125f};
+	const std::vector<int> ints{-1, 255, 1024};
+	Benchmark("print(vector<float>,3)", [&floats](PrintSink& sink, int) { sink.print(floats, 3); });
+	Benchmark("print(vector<int>,BIN)", [&ints](PrintSink& sink, int) { sink.print(ints, Print::RDL_BIN); });
+	Benchmark("print(vector<int>,HEX)", [&ints](PrintSink& sink, int) { sink.print(ints, Print::RDL_HEX); });
+	return 0;
+}
+
+// ======================= Functions ===================
+
+// Time CALLS calls of func, the sink is reserved first so its growth is not counted
+template <typename Func_T> void Benchmark(const char* name, Func_T func)
+{
+	PrintSink sink;
+	sink.out.reserve(1 << 24);
+	size_t allocsBefore = allocCount;
+	auto start = std::chrono::steady_clock::now();
+	for (int i = 0; i < CALLS; i++)
+	{
+		func(sink, i);
+		if (sink.out.size() > (1 << 23)) sink.out.clear();
+	}
+	auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+	printf("%-24s %10.1f %14.2f\n", name, elapsed / CALLS, static_cast<double>(allocCount - allocsBefore) / CALLS);
+}
+
+// ============== EOF =========
+
+/// @endcond
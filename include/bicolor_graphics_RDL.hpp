@@ -11,10 +11,16 @@
 #include <cstdio>
 #include <cstdint>
 #include <cmath> // for "abs"
+#include <span>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #include "print_data_RDL.hpp"
 #include "font_data_RDL.hpp"
 #include "common_data_RDL.hpp"
+#include "page_buffer_RDL.hpp"
 
 
 /*! @brief Graphics class to hold graphic related functions  for 1-bit displays*/
@@ -23,7 +29,18 @@ class bicolor_graphics : public display_Fonts, public Print{
  public:
 
 	bicolor_graphics(int16_t w, int16_t h); // Constructor
-	
+	virtual ~bicolor_graphics();
+
+	bicolor_graphics(const bicolor_graphics&) = delete;
+	bicolor_graphics& operator=(const bicolor_graphics&) = delete;
+
+	/*! What commitAsync does with a frame while a transfer is in flight */
+	enum class CommitPolicy_e : uint8_t
+	{
+		Queue = 0, /**< Frame waits for the transfer in flight, a newer commit replaces it: default*/
+		Drop = 1   /**< Frame is not committed, its changes go with the next commit*/
+	};
+
 	/*! Enum to hold current screen rotation in degrees bi color display  */
 	enum displayBC_rotate_e : uint8_t
 	{
@@ -42,8 +59,7 @@ class bicolor_graphics : public display_Fonts, public Print{
 	};
 	
 	// Graphic related member functions
-	/*! @brief define in the sub class */
-	virtual void drawPixel(int16_t x, int16_t y, uint8_t color) = 0;
+	virtual void drawPixel(int16_t x, int16_t y, uint8_t color) final;
 
 	rdlib::Return_Codes_e drawDotGrid(int16_t x, int16_t y, int16_t w, 
 		int16_t h, uint8_t DotGridGap, uint8_t color);
@@ -99,6 +115,18 @@ class bicolor_graphics : public display_Fonts, public Print{
 	void setDrawBitmapAddr(bool mode);
 	rdlib::Return_Codes_e drawBitmap(int16_t x, int16_t y, const std::span<const uint8_t> bitmap,
 			int16_t w, int16_t h, uint8_t color, uint8_t bg);
+	rdlib::Return_Codes_e bitBlt(int16_t x, int16_t y, const std::span<const uint8_t> bitmap,
+			int16_t w, int16_t h, page_buffer_1bpp::RasterOp_e op);
+
+	void markBufferDirty(void);
+
+	// Background buffer transfer
+	rdlib::Return_Codes_e commitAsyncBegin(CommitPolicy_e policy = CommitPolicy_e::Queue);
+	void commitAsyncEnd(void);
+	rdlib::Return_Codes_e commitAsync(void);
+	rdlib::Return_Codes_e waitCommit(void);
+	bool isCommitBusy(void);
+	uint32_t getCommitDroppedCount(void);
 
 protected:
 
@@ -114,14 +142,53 @@ protected:
 	int _arcAngleOffset= 0; /**< used by drawArc, offset for adjusting the starting angle of arc. default positive X-axis (0°)*/
 	bool _textwrap = true;  /**< If set, text at right edge of display will wrap, print method*/
 
+	void setPageBuffer(std::span<uint8_t> buffer, int16_t stride,
+		page_buffer_1bpp::RotationMap_e map = page_buffer_1bpp::RotationMap_e::Standard);
+
+	page_buffer_1bpp _pageBuffer; /**< sub class screen buffer, all drawing goes here, not attached = nothing drawn */
+
+	rdlib::Return_Codes_e updateFrame(std::span<const uint8_t> buffer);
+	virtual rdlib::Return_Codes_e sendFrame(std::span<const uint8_t> frame,
+		std::span<const page_buffer_1bpp::DirtyRange_t> dirty);
+
 private:
+
 	bool _drawBitmapAddr; /**< data addressing mode for method drawBitmap, True-vertical , false-horizontal */
+	std::vector<uint8_t> _blitColumns; /**< horizontal bitmap transposed for blit, kept to avoid allocating per call */
+
+	// Background buffer transfer, the two frames are owned here, the drawing buffer by the sub class
+	std::thread _commitThread;            /**< sends committed frames, runs from commitAsyncBegin to commitAsyncEnd*/
+	std::mutex _commitMutex;              /**< guards the commit members below*/
+	std::condition_variable _commitCond;  /**< signalled on commit, transfer complete and stop*/
+	CommitPolicy_e _commitPolicy = CommitPolicy_e::Queue; /**< what to do with frames committed while busy*/
+	bool _commitRunning = false;          /**< commit thread started*/
+	bool _commitStop = false;             /**< commit thread exits when no frame is queued*/
+	bool _commitQueued = false;           /**< _frameQueued waits to be sent*/
+	bool _commitInFlight = false;         /**< _frameInFlight is being sent*/
+	bool _commitResend = false;           /**< a transfer failed with no frame queued, send the whole buffer with the next commit or update*/
+	rdlib::Return_Codes_e _commitResult = rdlib::Success; /**< result of the last transfer*/
+	uint32_t _commitDropped = 0;          /**< frames committed but never sent*/
+	std::vector<uint8_t> _frameQueued;    /**< committed frame waiting for the commit thread*/
+	std::vector<uint8_t> _frameInFlight;  /**< frame being sent by the commit thread*/
+	std::vector<page_buffer_1bpp::DirtyRange_t> _dirtyQueued;   /**< columns to send of _frameQueued*/
+	std::vector<page_buffer_1bpp::DirtyRange_t> _dirtyInFlight; /**< columns to send of _frameInFlight*/
+	std::vector<page_buffer_1bpp::DirtyRange_t> _dirtyUpdate;   /**< columns to send of a blocking update*/
 
 	/// @cond
 	void fillCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, int16_t delta, uint8_t color);
 	void drawCircleHelper(int16_t x0, int16_t y0, int16_t r, uint8_t cornername, uint8_t color);
 	void ellipseHelper(uint16_t cx, uint16_t cy, uint16_t x, uint16_t y, uint8_t color);
 	void drawArcHelper(uint16_t cx, uint16_t cy, uint16_t radius, uint16_t thickness, float start, float end, uint8_t color);
+	bool pageFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t color);
+	bool pageBlit(int16_t x, int16_t y, std::span<const uint8_t> bitmap, int16_t w, int16_t h, page_buffer_1bpp::RasterOp_e op);
+	bool opaqueBitmapBlit(int16_t x, int16_t y, std::span<const uint8_t> bitmap, int16_t w, int16_t h, uint8_t color, uint8_t bg);
+	void takeDirtyPages(std::vector<page_buffer_1bpp::DirtyRange_t>& dirty, bool merge);
+	void commitThread(void);
+	// Pixel write used by all the graphics functions, same as the final drawPixel with no virtual call
+	inline void plotPixel(int16_t x, int16_t y, uint8_t color)
+	{
+		_pageBuffer.drawPixel(x, y, color);
+	}
 	inline void swapint16t(int16_t& a, int16_t& b) 
 	{
 		int16_t t = a;
@@ -0,0 +1,91 @@
+/*!
+	@file     bitbang_bus_RDL.hpp
+	@author   Gavin Lyons
+	@brief    Library header file for the bit banged (software) serial bus of the LED segment drivers.
+				TM1638, TM1637 and MAX7219 clock data out on GPIO lines. Short delays between
+				clock edges busy-wait instead of sleeping, and clock and data are written together
+				when the lines can be claimed as a group.
+*/
+
+#pragma once
+
+// Includes
+#include <cstdint>
+#include "common_data_RDL.hpp"
+
+/*!
+	@brief Class of static delay functions for bit banged buses
+	@details A sleep of any length costs a system call and tens of microseconds of scheduler latency,
+		far longer than the clock period these chips need. Delays up to SpinLimitMicroSec busy-wait
+		a loop count calibrated on first use, longer ones sleep. 0 is no delay at all.
+*/
+class bitbang_delay {
+
+public:
+	static constexpr uint32_t SpinLimitMicroSec = 20; /**< longest delay that busy-waits, uS*/
+
+	static void delayMicroSec(uint32_t microSec);
+	static uint32_t loopsPerMicroSec(void);
+
+private:
+	/// @cond
+	static void spin(uint64_t loops);
+	static uint32_t calibrate(void);
+	/// @endcond
+};
+
+/*!
+	@brief Class to drive a clock and data line pair as a bit banged serial bus
+	@details Data is sampled by the chip on the rising clock edge. The data line is changed in
+		the same GPIO write as the falling clock edge before it, one write instead of two.
+		Both lines are claimed as an lgpio group so that write sets them together, if the group
+		claim fails they are claimed singly and written one after the other, clock first.
+		The data line can be switched to input for reading keys, the group is split for that.
+		Claimed with LG_SET_OPEN_DRAIN a level of 1 releases the line instead, the pull-up sets it
+		high unless the chip holds it low, and readData reads the line without a new claim.
+*/
+class bitbang_bus {
+
+public:
+	/*! Order bits are shifted out and in */
+	enum class BitOrder_e : uint8_t
+	{
+		LSBFirst = 0, /**< bit 0 first, TM1638 TM1637*/
+		MSBFirst = 1  /**< bit 7 first, MAX7219*/
+	};
+
+	bitbang_bus() = default;
+	~bitbang_bus() = default;
+
+	int claim(int gpioHandle, uint8_t clock, uint8_t data, int lFlags = 0, bool idleLevel = false);
+	int release(void);
+	int setDataInput(void);
+	int setDataOutput(void);
+	bool isDataInput(void) const {return _dataInput;}
+
+	void setLines(bool clock, bool data);
+	void setClock(bool level);
+	void setData(bool level);
+	bool readData(void);
+	void shiftOut(uint8_t value, BitOrder_e order, uint32_t delayMicroSec);
+	uint8_t shiftIn(BitOrder_e order, uint32_t delayMicroSec);
+
+private:
+	/// @cond
+	void write(uint8_t levels, uint8_t mask);
+	static bool bitOf(uint8_t value, uint8_t index, BitOrder_e order);
+	static constexpr uint8_t ClockBit = 0x01; // bit of clock in group levels
+	static constexpr uint8_t DataBit = 0x02;  // bit of data in group levels
+	/// @endcond
+
+	int _GpioHandle = -1;    /**< handle to the gpiochip, from lgGpiochipOpen*/
+	uint8_t _Display_SCLK = 0;  /**< GPIO of clock line, group leader*/
+	uint8_t _Display_SDATA = 0; /**< GPIO of data line*/
+	int _lFlags = 0;         /**< lgpio line flags of claims*/
+	uint8_t _levels = 0;     /**< current levels, ClockBit and DataBit*/
+	bool _claimed = false;   /**< lines are claimed*/
+	bool _grouped = false;   /**< lines are claimed as one group*/
+	bool _dataInput = false; /**< data line is an input, clock claimed singly*/
+};
+
+// ********************** EOF *********************
@@ -15,12 +15,13 @@
 #include <cstdbool>
 #include <cstring>
 #include "bicolor_graphics_RDL.hpp"
+#include "spi_bus_arbiter_RDL.hpp"
 
 
 // CLASS SECTION 
 
 /*! @brief class to drive the ERMCh1115 OLED */
-class ERMCH1115 : public bicolor_graphics   {
+class ERMCH1115 : public bicolor_graphics, public spi_bus_device   {
 
 	private:
 
@@ -115,7 +116,10 @@ class ERMCH1115 : public bicolor_graphics   {
 
 		// methods
 		void send_data(uint8_t data);
+		void send_data(std::span<const uint8_t> data);
 		void send_command(uint8_t command, uint8_t value);
+		rdlib::Return_Codes_e sendFrame(std::span<const uint8_t> frame,
+			std::span<const page_buffer_1bpp::DirtyRange_t> dirty) override;
 		int8_t GetCommMode(void);
 		void SoftwareSPIShiftOut(uint8_t val);
 
@@ -127,9 +131,8 @@ class ERMCH1115 : public bicolor_graphics   {
 		ERMCH1115(int16_t oledwidth, int16_t oledheight , int8_t rst, int8_t dc, int8_t cs,  int8_t sclk, int8_t din);
 		// Constructor 2 Hardware SPI
 		ERMCH1115(int16_t oledwidth, int16_t oledheight , int8_t rst, int8_t dc);
-		~ERMCH1115(){};
+		~ERMCH1115(){commitAsyncEnd();};
 
-		virtual void drawPixel(int16_t x, int16_t y, uint8_t colour) override;
 
 		rdlib::Return_Codes_e OLEDSetBufferPtr(uint8_t width, uint8_t height , std::span<uint8_t> buffer);
 		rdlib::Return_Codes_e OLEDupdate(void);
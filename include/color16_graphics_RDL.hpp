@@ -16,11 +16,12 @@
 #include "print_data_RDL.hpp"
 #include "font_data_RDL.hpp"
 #include "common_data_RDL.hpp"
+#include "spi_bus_arbiter_RDL.hpp"
 
 /*!
 	@brief Class to handle fonts and graphics of color 16 bit display
 */
-class color16_graphics:public display_Fonts, public Print  {
+class color16_graphics:public display_Fonts, public Print, public spi_bus_device  {
 
  public:
 
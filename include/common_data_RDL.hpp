@@ -149,6 +149,13 @@ uint16_t LibraryVersion(void);
 #define Display_GPIO_FREE_SDATA lgGpioFree(_GpioHandle , _Display_SDATA)
 #define _XPT_GPIO_FREE_IRQ lgGpioFree(_GpioHandle , _IRQ_PIN)
 #define _XPT_GPIO_FREE_RST lgGpioFree(_GpioHandle , _RESET_PIN )
+// GPIO claim with line flags, and groups of lines written together
+#define Display_GPIO_CLAIM_OUTPUT lgGpioClaimOutput
+#define Display_GPIO_CLAIM_INPUT lgGpioClaimInput
+#define Display_GROUP_CLAIM_OUTPUT lgGroupClaimOutput
+#define Display_GROUP_WRITE lgGroupWrite
+#define Display_GROUP_READ lgGroupRead
+#define Display_GROUP_FREE lgGroupFree
 // SPI
 #define Display_OPEN_SPI lgSpiOpen(_spiDev, _spiChan, _spiBaud, _spiFlags)
 #define Display_CLOSE_SPI lgSpiClose(_spiHandle)
@@ -0,0 +1,187 @@
+/*!
+	@file     display_coroutine_RDL.hpp
+	@author   Gavin Lyons
+	@brief    Library header file for C++20 coroutine awaitables of display transfers.
+				A transfer runs on a worker thread, the awaiting coroutine is resumed
+				on the event loop thread that calls transfer_executor::poll or run.
+*/
+
+#pragma once
+
+// Includes
+#include <cstdint>
+#include <coroutine>
+#include <functional>
+#include <deque>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <span>
+#include "common_data_RDL.hpp"
+#include "color16_graphics_RDL.hpp"
+
+/*! @brief Name space for coroutine based display transfers */
+namespace rdlib_async {
+
+/*! Transfer function type, runs on the worker thread */
+using TransferFunc_t = std::function<rdlib::Return_Codes_e(void)>;
+
+/*!
+	@brief Class to run display transfers on worker threads and resume the awaiting coroutines
+	@details Transfers are started in submission order. With one worker they also run and
+		complete in that order, with more workers they run at the same time and can complete
+		in any order. Transfers that must not overlap need an executor with one worker.
+		Completed coroutines are queued and resumed by poll() or run(),
+		so all coroutine code runs on the one event loop thread.
+*/
+class transfer_executor {
+
+public:
+	transfer_executor(uint8_t workerCount = 1);
+	~transfer_executor();
+
+	transfer_executor(const transfer_executor&) = delete;
+	transfer_executor& operator=(const transfer_executor&) = delete;
+
+	void submit(TransferFunc_t transfer, std::coroutine_handle<> handle, rdlib::Return_Codes_e* result);
+	size_t poll(void);
+	void run(void);
+	size_t outstanding(void);
+
+private:
+/// @cond
+	/*! One queued transfer */
+	struct Job_t
+	{
+		TransferFunc_t transfer;
+		std::coroutine_handle<> handle;
+		rdlib::Return_Codes_e* result;
+	};
+	void workerThread(void);
+/// @endcond
+
+	std::mutex _jobMutex;                     /**< guards _jobs and _stop*/
+	std::condition_variable _jobCond;         /**< signalled when a job is queued or on stop*/
+	std::deque<Job_t> _jobs;                  /**< transfers waiting for a worker*/
+	bool _stop = false;                       /**< workers exit when set*/
+	std::mutex _doneMutex;                    /**< guards _done and _outstanding*/
+	std::condition_variable _doneCond;        /**< signalled when a transfer completes*/
+	std::vector<std::coroutine_handle<>> _done; /**< coroutines ready to resume*/
+	size_t _outstanding = 0;                  /**< transfers submitted, not yet resumed*/
+	std::vector<std::thread> _workers;        /**< worker threads*/
+};
+
+/*!
+	@brief Awaitable for one transfer, co_await gives the transfer return code
+*/
+class transfer_awaitable {
+
+public:
+	/*!
+		@brief Construct awaitable
+		@param executor executor to run the transfer on
+		@param transfer function to run on the worker
+	*/
+	transfer_awaitable(transfer_executor& executor, TransferFunc_t transfer)
+		: _executor(executor), _transfer(std::move(transfer)) {}
+
+	/*! @brief transfer always runs on the worker @return false */
+	bool await_ready(void) const noexcept {return false;}
+	/*!
+		@brief submit the transfer and suspend
+		@param handle the awaiting coroutine
+	*/
+	void await_suspend(std::coroutine_handle<> handle)
+	{
+		_executor.submit(std::move(_transfer), handle, &_result);
+	}
+	/*! @brief resume @return transfer return code */
+	rdlib::Return_Codes_e await_resume(void) const noexcept {return _result;}
+
+private:
+	transfer_executor& _executor; /**< executor running the transfer*/
+	TransferFunc_t _transfer;     /**< transfer to run*/
+	rdlib::Return_Codes_e _result = rdlib::Success; /**< set by worker before resume*/
+};
+
+/*!
+	@brief Coroutine return type for event loop tasks, starts eagerly and frees itself on completion
+*/
+struct Task {
+	/*! @brief promise type of Task */
+	struct promise_type {
+		/*! @brief @return the task */
+		Task get_return_object(void) noexcept {return {};}
+		/*! @brief start running straight away @return suspend_never */
+		std::suspend_never initial_suspend(void) noexcept {return {};}
+		/*! @brief free frame on completion @return suspend_never */
+		std::suspend_never final_suspend(void) noexcept {return {};}
+		/*! @brief co_return */
+		void return_void(void) noexcept {}
+		/*! @brief library does not use exceptions */
+		void unhandled_exception(void) noexcept {std::terminate();}
+	};
+};
+
+/*!
+	@brief Await an arbitrary transfer
+	@param executor executor to run the transfer on
+	@param transfer function run on the worker thread
+	@return awaitable, co_await gives the transfer return code
+*/
+inline transfer_awaitable transferAsync(transfer_executor& executor, TransferFunc_t transfer)
+{
+	return transfer_awaitable(executor, std::move(transfer));
+}
+
+/*!
+	@brief Await writeBuffer of a 16 bit color display in Advanced Screen Buffer mode
+	@param executor executor to run the transfer on
+	@param display the display
+	@return awaitable, co_await gives the writeBuffer return code
+	@note Do not draw into the screen buffer until the co_await completes.
+*/
+inline transfer_awaitable flushAsync(transfer_executor& executor, color16_graphics& display)
+{
+	return transfer_awaitable(executor, [&display]() { return display.writeBuffer(); });
+}
+
+/*!
+	@brief Await drawBitmap16 of a 16 bit color display
+	@param executor executor to run the transfer on
+	@param display the display
+	@param x X coordinate
+	@param y Y coordinate
+	@param data span to the bitmap data, must stay valid until the co_await completes
+	@param w width of the bitmap in pixels
+	@param h height of the bitmap in pixels
+	@return awaitable, co_await gives the drawBitmap16 return code
+*/
+inline transfer_awaitable drawBitmapAsync(transfer_executor& executor, color16_graphics& display,
+	uint16_t x, uint16_t y, std::span<const uint8_t> data, uint16_t w, uint16_t h)
+{
+	return transfer_awaitable(executor, [&display, x, y, data, w, h]() { return display.drawBitmap16(x, y, data, w, h); });
+}
+
+/*!
+	@brief Await the buffer update of a bicolor display, OLEDupdate or LCDupdate
+	@tparam Display_T a bicolor display class e.g. SSD1306_RDL, ERMCH1115, NOKIA_5110_RPI
+	@param executor executor to run the transfer on
+	@param display the display
+	@return awaitable, co_await gives the update return code
+	@note Do not draw into the display buffer until the co_await completes.
+*/
+template <typename Display_T>
+	requires requires (Display_T& d) { d.OLEDupdate(); } || requires (Display_T& d) { d.LCDupdate(); }
+transfer_awaitable flushAsync(transfer_executor& executor, Display_T& display)
+{
+	if constexpr (requires { display.OLEDupdate(); })
+		return transfer_awaitable(executor, [&display]() { return display.OLEDupdate(); });
+	else
+		return transfer_awaitable(executor, [&display]() { return display.LCDupdate(); });
+}
+
+} // namespace rdlib_async
+
+// ********************** EOF *********************
@@ -20,19 +20,20 @@
 #include <cstdint>
 #include <cstdbool>
 #include "bicolor_graphics_RDL.hpp"
+#include "spi_bus_arbiter_RDL.hpp"
 
 
 /*!
 	@brief class to drive the ERM19264 UC1609 LCD
 */
-class ERM19264_UC1609 : public bicolor_graphics {
+class ERM19264_UC1609 : public bicolor_graphics, public spi_bus_device {
 public:
 	 // Contructor 1 Software SPI with explicit SCLK and SDIN
 	ERM19264_UC1609(int16_t lcdwidth, int16_t lcdheight , int8_t rst, int8_t cd, int8_t cs,  int8_t sclk, int8_t din);
 	// Constructor 2 Hardware SPI
 	ERM19264_UC1609(int16_t lcdwidth, int16_t lcdheight , int8_t rst, int8_t cd);
 
-	~ERM19264_UC1609(){};
+	~ERM19264_UC1609(){commitAsyncEnd();};
 
 	/*! 
 		@brief enum to hold LCD Rotate command constants 
@@ -45,7 +46,6 @@ public:
 		UC1609_ROTATION_FLIP_THREE = 0x00  /**< mirror image Rotation LCD command*/
 	};
 
-	virtual void drawPixel(int16_t x, int16_t y, uint8_t colour) override;
 
 	rdlib::Return_Codes_e LCDupdate(void);
 	rdlib::Return_Codes_e LCDclearBuffer(void);
@@ -74,7 +74,10 @@ public:
   private:
 
 	void sendData(uint8_t data);
+	void sendData(std::span<const uint8_t> data);
 	void sendCommand(uint8_t command, uint8_t value);
+	rdlib::Return_Codes_e sendFrame(std::span<const uint8_t> frame,
+		std::span<const page_buffer_1bpp::DirtyRange_t> dirty) override;
 	int8_t GetCommMode(void);
 	void SoftwareSPIShiftOut(uint8_t val);
 
@@ -10,6 +10,9 @@
 #include <cstdio>
 #include <span>
 #include <array>
+#include <vector>
+#include <map>
+#include <mutex>
 #include "common_data_RDL.hpp" //error enum
 
 // Font data is in the cpp file accessed thru extern.
@@ -69,8 +72,11 @@ class display_Fonts
 		uint8_t _Font_Y_Size = 0x08; /**< Height Size of a Font character */
 		uint8_t _FontOffset = 0x20; /**< Offset in the ASCII table 0x00 to 0xFF, where font begins */
 		uint8_t _FontNumChars = 0x5E; /**< Number of characters in font 0x00 to 0xFE */
+
+		std::span<const uint8_t> getFontColumns(void);
 	private:
 		bool _FontInverted = false; /**< display font inverted? , False = no invert , true = invert*/
+		std::span<const uint8_t> _FontColumns; /**< Column-major copy of the active font, empty until getFontColumns */
 };
 
 
@@ -0,0 +1,105 @@
+/*!
+	@file     frame_scheduler_RDL.hpp
+	@author   Gavin Lyons
+	@brief    Library header file for frame pacing of 16 bit color displays.
+				Schedules buffer flushes on a monotonic clock at a target frame rate,
+				with optional tearing effect (TE) line synchronisation.
+*/
+
+#pragma once
+
+// Includes
+#include <cstdint>
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <thread>
+#include <lgpio.h>
+#include "common_data_RDL.hpp"
+#include "color16_graphics_RDL.hpp"
+
+/*!
+	@brief Class to pace the flushes of a 16 bit color display to a target frame rate.
+	@details Each call to presentFrame() sleeps until the next frame slot on
+		std::chrono::steady_clock then calls the flush function, writeBuffer() by default.
+		If the caller falls behind by a whole frame period or more, the missed slots
+		are dropped rather than flushed back to back, and a missed deadline is recorded.
+		Optionally the flush is started on the edge of the controller's TE output,
+		delivered either by lgpio GPIO alerts or by signalTearEdge() (simulated source).
+*/
+class frame_scheduler {
+
+public:
+
+	/*! Source of the tearing effect edge used to start a flush */
+	enum class TearSource_e : uint8_t
+	{
+		Off = 0,       /**< No TE sync, flush on the frame clock only: default*/
+		GpioAlert = 1, /**< TE output wired to a GPIO, edges delivered by lgpio alerts*/
+		Simulated = 2  /**< TE edges delivered by calls to signalTearEdge(), no hardware needed*/
+	};
+
+	/*! Frame timing statistics, see getFrameStats() */
+	struct FrameStats_t
+	{
+		uint32_t framesPresented = 0; /**< Number of frames flushed to the display*/
+		uint32_t framesSkipped = 0;   /**< Number of frame slots dropped because caller was behind*/
+		uint32_t missedDeadlines = 0; /**< Number of presentFrame calls arriving a frame period or more late*/
+		uint32_t tearTimeouts = 0;    /**< Number of flushes started without a TE edge (edge wait timed out)*/
+		std::chrono::microseconds lastFlushTime{0}; /**< Duration of the last flush*/
+		std::chrono::microseconds worstLateness{0}; /**< Largest lateness seen by presentFrame*/
+	};
+
+	/*! Flush function type, called once per presented frame */
+	using FlushFunc_t = std::function<rdlib::Return_Codes_e(void)>;
+	/*! Monotonic clock used for all frame timing */
+	using FrameClock_t = std::chrono::steady_clock;
+
+	frame_scheduler(color16_graphics& display, uint16_t targetFps = 30);
+	frame_scheduler(FlushFunc_t flushFunc, uint16_t targetFps = 30);
+	~frame_scheduler();
+
+	frame_scheduler(const frame_scheduler&) = delete;
+	frame_scheduler& operator=(const frame_scheduler&) = delete;
+
+	// Frame rate
+	rdlib::Return_Codes_e setTargetFps(uint16_t fps);
+	uint16_t getTargetFps(void) const;
+	void setFlushFunction(FlushFunc_t flushFunc);
+	void restartClock(void);
+	bool frameDue(void) const;
+	rdlib::Return_Codes_e presentFrame(void);
+
+	// Tearing effect sync
+	rdlib::Return_Codes_e TearSyncGpioBegin(int gpioHandle, int teGpio);
+	rdlib::Return_Codes_e TearSyncSimulatedBegin(void);
+	rdlib::Return_Codes_e TearSyncEnd(void);
+	TearSource_e getTearSource(void) const;
+	void signalTearEdge(void);
+
+	// Statistics
+	FrameStats_t getFrameStats(void) const;
+	void resetFrameStats(void);
+
+private:
+/// @cond
+	static void tearAlertCallback(int numAlerts, lgGpioAlert_p alerts, void *userdata);
+	bool waitForTearEdge(FrameClock_t::time_point limit);
+/// @endcond
+
+	FlushFunc_t _flushFunc;            /**< Called to flush a frame, writeBuffer by default*/
+	uint16_t _targetFps = 30;          /**< Target frames per second*/
+	FrameClock_t::duration _framePeriod = std::chrono::microseconds(1000000 / 30); /**< Period of one frame slot*/
+	FrameClock_t::time_point _nextDeadline{}; /**< Start time of the next frame slot*/
+	bool _clockStarted = false;        /**< false until first presentFrame or after restartClock*/
+	FrameStats_t _stats;               /**< Frame timing statistics*/
+
+	TearSource_e _tearSource = TearSource_e::Off; /**< Current TE source*/
+	int _tearGpioHandle = -1;          /**< gpiochip handle of TE GPIO, GpioAlert mode only*/
+	int _tearGpio = -1;                /**< GPIO number wired to TE output, GpioAlert mode only*/
+	std::mutex _tearMutex;             /**< Guards _tearEdgeCount*/
+	std::condition_variable _tearCond; /**< Signalled on each TE edge*/
+	uint32_t _tearEdgeCount = 0;       /**< Incremented on each TE edge*/
+};
+// ********************** EOF *********************
@@ -7,6 +7,9 @@
 #include <lgpio.h>
 #include "common_data_RDL.hpp"
 #include "print_data_RDL.hpp"
+#include "led_segment_shadow_RDL.hpp"
+#include <array>
+#include <vector>
 
 #pragma once
 
@@ -15,6 +18,9 @@
 
 /*!
 	@brief class to drive the HD44780  LCD with PCF8574 I2C interface
+	@details In buffer mode text goes to a virtual screen instead of the LCD, LCDFlush
+		then sends only the characters that differ from a shadow of the display DDRAM.
+		Custom characters printed with LCDPrintGlyph get one of the 8 CGRAM slots on demand.
 */
 class HD44780PCF8574LCD : public Print{
   public:
@@ -75,10 +81,14 @@ class HD44780PCF8574LCD : public Print{
 	void LCDI2CErrorTimeoutSet(uint16_t);
 	uint8_t LCDI2CErrorRetryNumGet(void);
 	void LCDI2CErrorRetryNumSet(uint8_t);
+	uint16_t LCDI2CBurstSizeGet(void);
+	void LCDI2CBurstSizeSet(uint16_t);
 
 	rdlib::Return_Codes_e LCDSendString (char *str);
 	void LCDSendChar (char data);
+	using Print::write;
 	virtual size_t write(uint8_t);
+	virtual size_t write(const uint8_t *buffer, size_t size);
 	rdlib::Return_Codes_e  LCDCreateCustomChar(uint8_t location, uint8_t* charmap);
 	void LCDPrintCustomChar(uint8_t location);
 	
@@ -91,9 +101,22 @@ class HD44780PCF8574LCD : public Print{
 	void LCDHome(void);
 	void LCDChangeEntryMode(LCDEntryMode_e mode);
 
+	void LCDBufferModeSet(bool);
+	bool LCDBufferModeGet(void);
+	rdlib::Return_Codes_e LCDFlush(void);
+	void LCDBufferInvalidate(void);
+	rdlib::Return_Codes_e LCDPrintGlyph(const uint8_t *glyph);
+
   private:
 	void LCDSendCmd (unsigned char cmd);
 	void LCDSendData (unsigned char data);
+	bool LCDSendDataRun(const uint8_t *data, size_t length);
+	void LCDSetDDRAMCursor(LCDLineNumber_e lineNo, uint8_t col);
+	bool LCDBufferRedirect(const uint8_t *data, size_t length);
+	void LCDShadowCleared(int8_t row);
+	void LCDShadowInvalidate(void);
+	int8_t LCDGlyphAllocate(const uint8_t *glyph);
+	bool LCDGlyphUpload(void);
 	
 	// Private Enums
 	/*!  DDRAM address's used to set cursor position  Note Private */
@@ -124,9 +147,30 @@ class HD44780PCF8574LCD : public Print{
 	uint16_t _I2C_ErrorDelay = 100; /**<I2C delay(in between retry attempts) in event of error in mS*/
 	uint8_t _I2C_ErrorRetryNum = 3; /**< In event of I2C error number of retry attempts*/
 	int _I2C_ErrorFlag = 0; /**< In event of I2C error holds code*/
+	static constexpr uint16_t I2CBurstSizeMax = 256; /**< Largest I2C write of a character run*/
+	uint16_t _I2CBurstSize = 128; /**< Most bytes in one I2C write of a character run, 4 per character*/
 	
 	uint8_t _NumRowsLCD = 2; /**< number of rows on LCD*/
 	uint8_t _NumColsLCD = 16; /**< number of columns on LCD*/
+	LCDEntryMode_e _LCDEntryMode = LCDEntryModeThree; /**< entry mode last set*/
+	LCDCursorType_e _LCDCursorType = LCDCursorTypeOff; /**< cursor type last set*/
+
+	static constexpr size_t LCDFlushMaxGap = 2; /**< Unchanged characters LCDFlush resends rather than a cursor set*/
+	bool _bufferMode = false; /**< Text goes to the virtual screen, sent by LCDFlush*/
+	uint8_t _bufferRow = 0; /**< Virtual screen cursor row 0-3*/
+	uint8_t _bufferCol = 0; /**< Virtual screen cursor column*/
+	std::vector<led_segment_shadow> _DDRAMShadow; /**< Per row, staged is the virtual screen, shadow is the DDRAM*/
+
+	static constexpr uint8_t CGRAMSlots = 8; /**< Custom character slots in CGRAM*/
+	/*! A CGRAM slot as used by LCDPrintGlyph */
+	struct LCDGlyphSlot_t {
+		std::array<uint8_t, 8> bitmap{}; /**< Glyph held, valid if resident*/
+		bool resident = false; /**< Slot holds bitmap, or will after the pending upload*/
+		bool pending = false;  /**< bitmap is to be uploaded by the next LCDFlush*/
+		uint32_t lastUse = 0;  /**< _glyphClock of last print, for least recently used eviction*/
+	};
+	std::array<LCDGlyphSlot_t, CGRAMSlots> _glyphSlots{}; /**< CGRAM slots*/
+	uint32_t _glyphClock = 0; /**< Counts glyph prints*/
 
   }; // end of HD44780PCF8574LCD class
 
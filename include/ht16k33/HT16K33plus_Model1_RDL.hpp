@@ -18,6 +18,7 @@
 #include <lgpio.h>
 #include "common_data_RDL.hpp"
 #include "led_segment_font_data_RDL.hpp"
+#include "led_segment_shadow_RDL.hpp"
 
 /*! @brief class to control Ht16K33 , supports 7 9 14 and 16 segment displays */
 class HT16K33plus_Model1 : public SevenSegmentFont, public  NineSegmentFont, 
@@ -82,11 +83,16 @@ class HT16K33plus_Model1 : public SevenSegmentFont, public  NineSegmentFont,
 		void  setBlink(BlinkFreq_e  value);
 		BlinkFreq_e  getBlink() const;
 		DisplayType_e getDisplayType() const;
+		uint8_t getNumOfDigits() const;
+		void invalidateShadow(void);
+		void commitFrame(void);
 
 		// Display data related
 		void ClearDigits(void);
 		//raw data segments
 		void displayRawData(uint8_t digitPos, uint16_t value);
+		void stageRawData(uint8_t digitPos, uint16_t value);
+		uint16_t getCharSegments(char c, DecimalPoint_e dp) const;
 		// Display data
 		rdlib::Return_Codes_e displayChar(uint8_t digitPos, char c, DecimalPoint_e dp);
 		rdlib::Return_Codes_e displayText(const char *text, TextAlignment_e TextAlignment);
@@ -97,6 +103,7 @@ class HT16K33plus_Model1 : public SevenSegmentFont, public  NineSegmentFont,
 	protected:
 
 	private:
+		rdlib::Return_Codes_e stageChar(uint8_t digitPos, char c, DecimalPoint_e dp);
 		rdlib::Return_Codes_e displayMultiSegNum(uint8_t digitPos, char c, DecimalPoint_e dp);
 
 		// methods I2C related
@@ -120,6 +127,9 @@ class HT16K33plus_Model1 : public SevenSegmentFont, public  NineSegmentFont,
 		static constexpr uint8_t HT16K33_DISPLAYON =  0x81; /**< Display set register  Display on */
 		static constexpr uint8_t HT16K33_DISPLAYOFF = 0x80; /**< Display set register  Display off */
 		static constexpr uint8_t HT16K33_BRIGHTNESS = 0xE0; /**< Dimming set register 0-15 XXXX-BBBB*/
+		static constexpr uint8_t HT16K33_RAM_SIZE =  16;    /**< Display data RAM bytes, two per digit */
+
+		led_segment_shadow _displayRAM{HT16K33_RAM_SIZE}; /**< shadow of display RAM, stage then commitFrame() */
 
 		BlinkFreq_e _blinkSetting = BLINKOFF; /**< Blink setting, 4 settings see enum */
 		DisplayType_e  _displayType = SegType7; /**< Enum to hold chosen display type */
@@ -56,6 +56,7 @@ public:
 	// screen related
 	void setRotation(display_rotate_e rotation);
 	void invertDisplay(bool i);
+	void tearingEffect(bool enable);
 	void scrollTo(uint16_t y);
 	void setScrollMargins(uint16_t top, uint16_t bottom);
 	void NormalMode(void);
@@ -110,6 +111,8 @@ private:
 
 	static constexpr uint8_t ILI9341_PTLAR     = 0x30; /**< Partial Area */
 	static constexpr uint8_t ILI9341_VSCRDEF   = 0x33; /**< Vertical Scrolling Definition */
+	static constexpr uint8_t ILI9341_TEOFF     = 0x34; /**< Tearing Effect Line OFF */
+	static constexpr uint8_t ILI9341_TEON      = 0x35; /**< Tearing Effect Line ON */
 	static constexpr uint8_t ILI9341_MADCTL    = 0x36; /**< Memory Access Control */
 	static constexpr uint8_t ILI9341_VSCRSADD  = 0x37; /**< Vertical Scrolling Start Address */
 	static constexpr uint8_t ILI9341_PIXFMT    = 0x3A; /**< COLMOD: Pixel Format Set */
@@ -0,0 +1,95 @@
+/*!
+	@file     led_segment_marquee_RDL.hpp
+	@author   Gavin Lyons
+	@brief    Library header file for scrolling text on the LED segment displays.
+				TM1638, TM1637, MAX7219 and HT16K33. The text is encoded once into a strip
+				of segment codes, a timer thread then shows a window of the strip per step.
+*/
+
+#pragma once
+
+// Includes
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+#include "common_data_RDL.hpp"
+
+class TM1638plus_Model1;
+class TM1638plus_Model2;
+class TM1637plus_Model4;
+class MAX7219_SS_RPI;
+class HT16K33plus_Model1;
+
+/*!
+	@brief Class to scroll text right to left across a LED segment display
+	@details setText encodes the text through the display's font into a strip of segment codes,
+		padded with a display width of blanks at each end. Each step shows the next window of
+		the strip, so the text enters on the right and leaves on the left. A step costs no font
+		lookups, the window is passed to the display's raw segment write, which through its
+		display RAM shadow sends only the digits that changed, in one burst.
+		Steps are run by a timer thread between start() and stop(), or by calling step().
+		While the thread runs it is the only user of the display.
+*/
+class led_segment_marquee {
+
+public:
+
+	/*! Encodes a character to segment code, called by setText only */
+	using EncodeFunc_t = std::function<uint16_t(char character, bool dot)>;
+	/*! Writes a window of segment codes to the display, leftmost digit first, once per step */
+	using FrameFunc_t = std::function<void(std::span<const uint16_t> window)>;
+
+	led_segment_marquee(TM1638plus_Model1& display);
+	led_segment_marquee(TM1638plus_Model2& display);
+	led_segment_marquee(TM1637plus_Model4& display);
+	led_segment_marquee(MAX7219_SS_RPI& display);
+	led_segment_marquee(HT16K33plus_Model1& display);
+	led_segment_marquee(uint16_t digits, EncodeFunc_t encode, FrameFunc_t frame);
+	~led_segment_marquee();
+
+	led_segment_marquee(const led_segment_marquee&) = delete;
+	led_segment_marquee& operator=(const led_segment_marquee&) = delete;
+
+	rdlib::Return_Codes_e setText(const char *text);
+	rdlib::Return_Codes_e setStepPeriod(uint16_t periodMs);
+	uint16_t getStepPeriod(void) const;
+	void setLoop(bool loop);
+	uint16_t getDigits(void) const;
+
+	rdlib::Return_Codes_e start(void);
+	void stop(void);
+	bool isRunning(void) const;
+	bool step(void);
+	void rewind(void);
+
+private:
+/// @cond
+	using StepClock_t = std::chrono::steady_clock;
+	static constexpr char ASCIIOffset = 0x20; // first character in the fonts, space
+	static constexpr char ASCIIEnd = 0x7B;    // last character in the fonts + 1, after 'z'
+
+	bool advance(void);
+	void stepThread(void);
+/// @endcond
+
+	uint16_t _digits = 0;                 /**< digits on the display, width of the window*/
+	EncodeFunc_t _encode;                 /**< character to segment code, display font*/
+	FrameFunc_t _frame;                   /**< writes a window to the display*/
+	std::vector<uint16_t> _strip;         /**< blanks, encoded text, blanks*/
+	size_t _position = 1;                 /**< start of the next window in _strip*/
+	bool _loop = true;                    /**< start again after the text has left the display*/
+	std::atomic<uint16_t> _stepPeriodMs{250}; /**< time between steps*/
+
+	std::mutex _mutex;                    /**< guards _strip, _position, _loop and the display writes*/
+	std::condition_variable _stopCond;    /**< wakes the step thread for stop*/
+	std::atomic<bool> _running{false};    /**< step thread running*/
+	std::thread _thread;                  /**< step thread*/
+};
+
+// ********************** EOF *********************
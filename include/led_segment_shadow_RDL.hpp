@@ -0,0 +1,165 @@
+/*!
+	@file     led_segment_shadow_RDL.hpp
+	@author   Gavin Lyons
+	@brief    Library header file for a shadow copy of the display RAM of the LED segment drivers.
+				TM1638, TM1637, HT16K33 and MAX7219 keep what was last written to the chip here,
+				so writing a digit that did not change costs no bus traffic.
+				The HD44780 LCD keeps one per row as the shadow of its DDRAM in buffer mode.
+*/
+
+#pragma once
+
+// Includes
+#include <cstdint>
+#include <span>
+#include <vector>
+
+/*!
+	@brief Class to hold a shadow copy of a LED driver chip's display RAM
+	@details Drivers stage the bytes they want on the display, then commit.
+		commit() finds the bytes that differ from the shadow, or were never sent, and passes them
+		to the driver's send function as spans of consecutive addresses, for chips with auto-increment
+		addressing each span is one burst. Unchanged bytes between two changes are sent inside the span
+		when the gap is no more than maxGap bytes, as resending them is cheaper than a new transaction.
+		Bytes are unknown until first sent, after a failed send or after invalidate().
+*/
+class led_segment_shadow {
+
+public:
+	/*!
+		@brief Construct a shadow, all bytes unknown
+		@param size number of display RAM bytes
+	*/
+	explicit led_segment_shadow(size_t size = 0) {resize(size);}
+
+	/*!
+		@brief Set the number of display RAM bytes, all bytes become unknown
+		@param size number of display RAM bytes
+	*/
+	void resize(size_t size)
+	{
+		_shadow.assign(size, 0);
+		_staged.assign(size, 0);
+		_flags.assign(size, 0);
+	}
+
+	/*! @brief @return number of display RAM bytes */
+	size_t size(void) const {return _staged.size();}
+
+	/*!
+		@brief Forget what the chip holds, bytes ever staged are sent again on the next commit
+		@details Use when the chip was reset or power cycled, or its RAM was written by other code.
+	*/
+	void invalidate(void) {invalidate(0, _flags.size());}
+
+	/*!
+		@brief Forget what the chip holds for a range of addresses
+		@param first first address
+		@param length number of addresses
+	*/
+	void invalidate(size_t first, size_t length)
+	{
+		for (size_t address = first; address < first + length && address < _flags.size(); address++)
+			if (_flags[address]) _flags[address] = Touched;
+	}
+
+	/*!
+		@brief Stage a byte for the next commit
+		@param address display RAM address, ignored if outside the shadow
+		@param value byte to be on the display
+	*/
+	void stage(size_t address, uint8_t value)
+	{
+		if (address >= _staged.size()) return;
+		_staged[address] = value;
+		_flags[address] |= Touched;
+	}
+
+	/*!
+		@brief Get a staged byte, the byte on the display if unchanged
+		@param address display RAM address
+		@return staged byte, 0 if address is outside the shadow
+	*/
+	uint8_t staged(size_t address) const
+	{
+		return (address < _staged.size()) ? _staged[address] : 0;
+	}
+
+	/*!
+		@brief Check if a staged byte needs to be sent
+		@param address display RAM address
+		@return true if the byte differs from the chip or the chip's byte is unknown
+	*/
+	bool isChanged(size_t address) const
+	{
+		if (address >= _flags.size()) return false;
+		if (_flags[address] & Known) return _staged[address] != _shadow[address];
+		return (_flags[address] & Touched) != 0;
+	}
+
+	/*!
+		@brief Record the result of sending a range of staged bytes
+		@param first first address sent
+		@param length number of bytes sent
+		@param success true if the chip has the bytes, false makes them unknown so they are sent again
+	*/
+	void markSent(size_t first, size_t length, bool success)
+	{
+		for (size_t address = first; address < first + length && address < _flags.size(); address++)
+		{
+			if (success)
+			{
+				_shadow[address] = _staged[address];
+				_flags[address] = Known;
+			} else
+			{
+				_flags[address] = Touched;
+			}
+		}
+	}
+
+	/*!
+		@brief Send the staged bytes that changed, in as few spans as the gap allows
+		@tparam Send_T callable bool(size_t first, std::span<const uint8_t> data), returns true on success
+		@param maxGap most unchanged bytes to resend to join two changed spans into one
+		@param send function to write data to consecutive display RAM addresses from first
+		@return true if every send succeeded or nothing needed sending
+	*/
+	template <typename Send_T>
+	bool commit(size_t maxGap, Send_T&& send)
+	{
+		bool result = true;
+		const size_t size = _staged.size();
+		size_t address = 0;
+		while (address < size)
+		{
+			if (!isChanged(address)) {address++; continue;}
+			size_t first = address;
+			size_t last = address;
+			// extend over gaps of known bytes up to the next change
+			for (size_t next = last + 1; next < size && next - last - 1 <= maxGap; next++)
+			{
+				if (isChanged(next)) {last = next; continue;}
+				if (!(_flags[next] & Known)) break;
+			}
+			size_t length = last - first + 1;
+			bool success = send(first, std::span<const uint8_t>(_staged.data() + first, length));
+			markSent(first, length, success);
+			if (!success) result = false;
+			address = last + 1;
+		}
+		return result;
+	}
+
+private:
+	/// @cond
+	static constexpr uint8_t Known = 0x01;   // _shadow holds what the chip has
+	static constexpr uint8_t Touched = 0x02; // _staged was written, send if not known
+	/// @endcond
+
+	std::vector<uint8_t> _shadow; /**< display RAM as last sent to the chip*/
+	std::vector<uint8_t> _staged; /**< display RAM as it should be after the next commit*/
+	std::vector<uint8_t> _flags;  /**< Known and Touched flags per address*/
+};
+
+// ********************** EOF *********************
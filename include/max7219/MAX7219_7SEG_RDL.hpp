@@ -11,9 +11,12 @@
 // Libraries
 #include <cstring>
 #include <cstdio> //snprintf
+#include <span>
 #include <lgpio.h>
 #include "led_segment_font_data_RDL.hpp"
 #include "common_data_RDL.hpp"
+#include "led_segment_shadow_RDL.hpp"
+#include "bitbang_bus_RDL.hpp"
 
 
 /*!
@@ -109,6 +112,7 @@ public:
 	rdlib::Return_Codes_e InitDisplay(ScanLimit_e numDigits, DecodeMode_e decodeMode);
 	void ClearDisplay(void);
 	rdlib::Return_Codes_e DisplayEndOperations(void);
+	void InvalidateShadow(void);
 
 	void SetBrightness(uint8_t brightness);
 	void DisplayTestMode(bool OnOff);
@@ -122,6 +126,8 @@ public:
 
 	uint8_t GetCurrentDisplayNumber(void);
 	void SetCurrentDisplayNumber(uint8_t);
+	uint8_t GetNumberOfDisplays(void);
+	uint8_t GetNumberOfDigits(void);
 
 	void DisplayChar(uint8_t digit, uint8_t value, DecimalPoint_e decimalPoint);
 	rdlib::Return_Codes_e DisplayText(char *text, TextAlignment_e TextAlignment);
@@ -132,6 +138,11 @@ public:
 	rdlib::Return_Codes_e DisplayBCDText(char *text);
 	void SetSegment(uint8_t digit, uint8_t segment);
 
+	rdlib::Return_Codes_e DisplayFrame(std::span<const uint8_t> frame);
+	uint8_t GetCharSegments(uint8_t character, DecimalPoint_e decimalPoint);
+
+	static constexpr uint8_t DigitsPerDisplay = 8; /**< Digit registers per MAX7219, frame bytes per display*/
+
 protected:
 
 
@@ -157,9 +168,12 @@ private:
 
 	uint8_t _CurrentDisplayNumber = 1; /**< Which display the user wishes to write to in a cascade of connected displays*/
 	uint8_t _NoDisplays = 1; /**< Number of displays in cascade, default is 1 */
+	led_segment_shadow _digitShadow; /**< Digit registers as last written, DigitsPerDisplay bytes per display */
+	bitbang_bus _bus; /**< CLK and DIN lines, SW SPI only */
 
 	void HighFreqshiftOut(uint8_t value);
 	void WriteDisplay(uint8_t RegisterCode, uint8_t data);
+	bool WriteChain(uint8_t RegisterCode, std::span<const uint8_t> data);
 	uint8_t ASCIIFetch(uint8_t character,DecimalPoint_e decimalPoint);
 	void SetDecodeMode(DecodeMode_e mode);
 	void SetScanLimit(ScanLimit_e numDigits);
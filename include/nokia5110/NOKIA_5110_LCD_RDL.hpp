@@ -13,15 +13,17 @@
 #include <cstdint>
 #include <cstdbool>
 #include <cstdio>
+#include <algorithm>
 #include <lgpio.h>
 #include "bicolor_graphics_RDL.hpp"
+#include "spi_bus_arbiter_RDL.hpp"
 
 // Classes
 
 /*!
 	@brief Class Controls SPI comms and LCD functionality
 */
-class NOKIA_5110_RPI : public bicolor_graphics 
+class NOKIA_5110_RPI : public bicolor_graphics, public spi_bus_device 
 {
 
 public:
@@ -30,7 +32,7 @@ public:
 	NOKIA_5110_RPI(int16_t lcdwidth, int16_t lcdheight, uint8_t LCD_RST, uint8_t LCD_DC, uint8_t LCD_CE, int8_t LCD_DIN, int8_t LCD_CLK);
 	//HW SPI 
 	NOKIA_5110_RPI(int16_t lcdwidth, int16_t lcdheight, uint8_t LCD_RST, uint8_t LCD_DC);
-	~NOKIA_5110_RPI(){};
+	~NOKIA_5110_RPI(){commitAsyncEnd();};
 
 	// SW SPI 
 	rdlib::Return_Codes_e LCDBegin(bool Inverse, uint8_t Contrast,uint8_t Bias, int gpioDev);
@@ -49,15 +51,16 @@ public:
 	rdlib::Return_Codes_e LCDupdate(void);
 	rdlib::Return_Codes_e LCDclearBuffer(uint8_t pattern = 0x00);
 	void LCDfillScreen(uint8_t pattern = 0x00);
-	virtual void drawPixel(int16_t x, int16_t y, uint8_t color) override;
 
 	void LCDSetContrast(uint8_t con);
 	void LCDinvertDisplay(bool inv);
 
 private:
 
-	void LCDBuffer(std::span<uint8_t> data);
+	rdlib::Return_Codes_e sendFrame(std::span<const uint8_t> frame,
+		std::span<const page_buffer_1bpp::DirtyRange_t> dirty) override;
 	void LCDWriteData(uint8_t data);
+	void LCDWriteData(std::span<const uint8_t> data);
 	void LCDWriteCommand(uint8_t command);
 	void LCDInit(void);
 
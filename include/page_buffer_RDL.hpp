@@ -0,0 +1,384 @@
+/*!
+	@file     page_buffer_RDL.hpp
+	@author   Gavin Lyons
+	@brief    Library header file for the 1-bit page layout screen buffer shared by the bicolor displays.
+				SSD1306, SH110X, CH1115, ERM19264 and Nokia 5110 all store 8 vertical pixels
+				per byte, LSB at top, one row of stride bytes per page of 8 lines.
+				Tracks which columns of each page changed so updates can send only those.
+*/
+
+#pragma once
+
+// Includes
+#include <cstdint>
+#include <span>
+#include <vector>
+#include <algorithm>
+
+/*!
+	@brief Class to hold a view of a 1-bit page layout screen buffer and draw into it
+	@details Rotation is mapped to raw buffer coordinates here, once for each pixel or
+		once for each rectangle, so callers do not need a virtual call per pixel.
+		Colors are as bicolor_graphics::pixel_color_e, 0 WHITE, 1 BLACK, 2 INVERSE.
+		Every write marks its page and column range dirty. takeDirty() trims a page's
+		range against a copy of what was last sent, so redrawing unchanged content costs nothing.
+*/
+class page_buffer_1bpp {
+
+public:
+	/*! Column range of a page to send, raw columns, first > last when nothing to send */
+	struct DirtyRange_t
+	{
+		int16_t first; /**< first column*/
+		int16_t last;  /**< last column*/
+	};
+
+	/*! Raster operation of blit, destination bits combined with source bits */
+	enum class RasterOp_e : uint8_t
+	{
+		Copy = 0,  /**< destination = source*/
+		Or = 1,    /**< destination = destination OR source*/
+		And = 2,   /**< destination = destination AND source*/
+		Xor = 3,   /**< destination = destination XOR source*/
+		NotSrc = 4 /**< destination = NOT source*/
+	};
+
+	/*! How rotation 90 and 270 degrees map to raw buffer coordinates */
+	enum class RotationMap_e : uint8_t
+	{
+		Standard = 0, /**< 90 degrees: x = WIDTH-1-y , y = x. OLEDs and ERM19264*/
+		Swapped = 1   /**< 90 degrees: x = y , y = HEIGHT-1-x. Nokia 5110*/
+	};
+
+	/*!
+		@brief Attach a screen buffer
+		@param buffer screen buffer
+		@param width raw screen width in pixels
+		@param height raw screen height in pixels
+		@param stride bytes per page row, at least width
+		@param map how rotation 90 and 270 are mapped
+		@return false and detached, if buffer is smaller than stride * (height/8) or stride less than width
+	*/
+	bool attach(std::span<uint8_t> buffer, int16_t width, int16_t height, int16_t stride, RotationMap_e map)
+	{
+		if (width <= 0 || height <= 0 || stride < width ||
+			buffer.size() < static_cast<size_t>(stride) * ((height + 7) / 8))
+		{
+			detach();
+			return false;
+		}
+		_buffer = buffer;
+		_width = width;
+		_height = height;
+		_stride = stride;
+		_map = map;
+		setRotation(_rotation);
+		_dirty.resize((height + 7) / 8);
+		_sendFull.resize(_dirty.size());
+		_shadow.assign(static_cast<size_t>(stride) * _dirty.size(), 0);
+		resendAll();
+		return true;
+	}
+
+	/*! @brief Detach the screen buffer, drawing is then ignored */
+	void detach(void)
+	{
+		_buffer = {};
+		_dirty.clear();
+		_sendFull.clear();
+		_shadow.clear();
+	}
+
+	/*! @brief Is a screen buffer attached @return true if attached */
+	bool isAttached(void) const {return !_buffer.empty();}
+
+	/*! @brief Get the attached screen buffer @return the buffer, empty if detached */
+	std::span<const uint8_t> data(void) const {return _buffer;}
+
+	/*!
+		@brief Set the rotation used to map coordinates
+		@param rotation 0-3 as bicolor_graphics::displayBC_rotate_e
+	*/
+	void setRotation(uint8_t rotation)
+	{
+		_rotation = rotation & 3;
+		_rawRotation = _rotation;
+		if (_map == RotationMap_e::Swapped && (_rotation & 1))
+			_rawRotation ^= 2; // 90 <-> 270
+		_rotWidth = (_rotation & 1) ? _height : _width;
+		_rotHeight = (_rotation & 1) ? _width : _height;
+	}
+
+	/*!
+		@brief Draw a pixel, rotated coordinates, clipped to the screen
+		@param x x co-ord of pixel
+		@param y y co-ord of pixel
+		@param color 0 WHITE, 1 BLACK, 2 INVERSE
+	*/
+	void drawPixel(int16_t x, int16_t y, uint8_t color)
+	{
+		if (_buffer.empty() || !toRaw(x, y))
+			return;
+		uint8_t& cell = _buffer[(_stride * (y / 8)) + x];
+		uint8_t bit = static_cast<uint8_t>(1 << (y & 7));
+		markDirty(y / 8, x, x);
+		switch (color)
+		{
+			case 0: cell &= ~bit; break;
+			case 1: cell |= bit;  break;
+			case 2: cell ^= bit;  break;
+		}
+	}
+
+	/*!
+		@brief Fill a rectangle, rotated coordinates, clipped to the screen
+		@param x x co-ord of top left
+		@param y y co-ord of top left
+		@param w width, nothing drawn if 0 or less
+		@param h height, nothing drawn if 0 or less
+		@param color 0 WHITE, 1 BLACK, 2 INVERSE
+		@details Maps the rectangle to raw coordinates once then does one masked byte
+			operation per column per page.
+	*/
+	void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t color)
+	{
+		if (_buffer.empty())
+			return;
+		int32_t x0 = std::max<int32_t>(x, 0);
+		int32_t y0 = std::max<int32_t>(y, 0);
+		int32_t x1 = std::min<int32_t>(static_cast<int32_t>(x) + w, _rotWidth);
+		int32_t y1 = std::min<int32_t>(static_cast<int32_t>(y) + h, _rotHeight);
+		if (x0 >= x1 || y0 >= y1)
+			return;
+
+		int32_t px, py, pw, ph;
+		switch (_rawRotation)
+		{
+			case 1:  px = _width - y1; py = x0;           pw = y1 - y0; ph = x1 - x0; break;
+			case 2:  px = _width - x1; py = _height - y1; pw = x1 - x0; ph = y1 - y0; break;
+			case 3:  px = y0;          py = _height - x1; pw = y1 - y0; ph = x1 - x0; break;
+			default: px = x0;          py = y0;           pw = x1 - x0; ph = y1 - y0; break;
+		}
+
+		int32_t pyEnd = py + ph;
+		for (int32_t page = py / 8; page <= (pyEnd - 1) / 8; page++)
+		{
+			int32_t top = std::max(py, page * 8) - page * 8;
+			int32_t bottom = std::min(pyEnd, page * 8 + 8) - page * 8;
+			uint8_t mask = static_cast<uint8_t>((0xFF << top) & (0xFF >> (8 - bottom)));
+			uint8_t* column = _buffer.data() + (page * _stride) + px;
+			markDirty(page, px, px + pw - 1);
+			switch (color)
+			{
+				case 0: for (int32_t i = 0; i < pw; i++) column[i] &= ~mask; break;
+				case 1: for (int32_t i = 0; i < pw; i++) column[i] |= mask;  break;
+				case 2: for (int32_t i = 0; i < pw; i++) column[i] ^= mask;  break;
+			}
+		}
+	}
+
+	/*!
+		@brief Combine a column-major 1-bit image into the buffer with a raster operation
+		@param x x co-ord of top left
+		@param y y co-ord of top left, need not be page aligned
+		@param image (h+7)/8 page rows of w bytes, one byte per column, LSB at top
+		@param w image width
+		@param h image height
+		@param op raster operation, set bits are BLACK pixels
+		@return false if no buffer is attached, true otherwise, clipped to the screen
+		@details At rotation 0 each image byte is shifted to the y offset and masked into
+			one or two buffer pages, instead of 8 pixel writes. Other rotations go pixel by pixel.
+	*/
+	bool blit(int16_t x, int16_t y, std::span<const uint8_t> image, int16_t w, int16_t h, RasterOp_e op)
+	{
+		if (_buffer.empty())
+			return false;
+		const int32_t imagePages = (h + 7) / 8;
+		if (w <= 0 || h <= 0 || image.size() < static_cast<size_t>(imagePages * w))
+			return true;
+		if (_rawRotation != 0)
+		{
+			blitPixels(x, y, image, w, h, op);
+			return true;
+		}
+		const int32_t pages = (_height + 7) / 8;
+		const int32_t xFirst = std::max<int32_t>(x, 0);
+		const int32_t xLast = std::min<int32_t>(static_cast<int32_t>(x) + w, _width) - 1;
+		if (xFirst > xLast)
+			return true;
+		const int32_t shift = y & 7; // y floor-divided into page and bit
+		const int32_t pageTop = (y - shift) / 8;
+
+		for (int32_t imagePage = 0; imagePage < imagePages; imagePage++)
+		{
+			const int32_t rows = std::min<int32_t>(h - (imagePage * 8), 8);
+			const uint16_t rowMask = static_cast<uint16_t>(((1 << rows) - 1) << shift);
+			const uint8_t* source = image.data() + (imagePage * w) + (xFirst - x);
+			for (int32_t half = 0; half < 2; half++)
+			{
+				const int32_t page = pageTop + imagePage + half;
+				const uint8_t mask = static_cast<uint8_t>(rowMask >> (half * 8));
+				if (mask == 0 || page < 0 || page >= pages)
+					continue;
+				uint8_t* column = _buffer.data() + (page * _stride) + xFirst;
+				markDirty(page, xFirst, xLast);
+				for (int32_t i = 0; i <= xLast - xFirst; i++)
+				{
+					uint8_t bits = static_cast<uint8_t>((source[i] << shift) >> (half * 8));
+					column[i] = rasterOp(column[i], bits, mask, op);
+				}
+			}
+		}
+		return true;
+	}
+
+	/*!
+		@brief Mark the whole buffer as changed
+		@details Call after the buffer was written other than through page_buffer_1bpp,
+			e.g. a memset. Columns that match what was last sent are still trimmed.
+	*/
+	void markAllDirty(void)
+	{
+		for (DirtyRange_t& range : _dirty)
+			range = {0, static_cast<int16_t>(_width - 1)};
+	}
+
+	/*!
+		@brief Mark the whole buffer to be sent in full on the next update
+		@details Call after the screen was written other than from the buffer, e.g. init,
+			fill screen or bitmap, so what was last sent no longer matches the screen.
+	*/
+	void resendAll(void)
+	{
+		for (uint8_t page = 0; page < _dirty.size(); page++)
+			resendPage(page);
+	}
+
+	/*!
+		@brief Mark a page to be sent in full on the next update
+		@param page page number
+	*/
+	void resendPage(uint8_t page)
+	{
+		if (page >= _dirty.size()) return;
+		_dirty[page] = {0, static_cast<int16_t>(_width - 1)};
+		_sendFull[page] = true;
+	}
+
+	/*!
+		@brief Get the columns of a page to send and mark them as sent
+		@param page page number
+		@return column range to send, first > last if the page is unchanged.
+			If no buffer is attached the whole page, last is then INT16_MAX and the caller clamps it.
+	*/
+	DirtyRange_t takeDirty(uint8_t page)
+	{
+		if (page >= _dirty.size())
+			return {0, INT16_MAX};
+		DirtyRange_t range = _dirty[page];
+		bool trim = !_sendFull[page];
+		_dirty[page] = {_width, -1};
+		_sendFull[page] = false;
+		if (range.first > range.last)
+			return range;
+		const uint8_t* data = _buffer.data() + (page * _stride);
+		uint8_t* sent = _shadow.data() + (page * _stride);
+		if (trim)
+		{
+			// trim columns that match what the screen already shows
+			while (range.first <= range.last && data[range.first] == sent[range.first]) range.first++;
+			while (range.last >= range.first && data[range.last] == sent[range.last]) range.last--;
+			if (range.first > range.last)
+				return range;
+		}
+		std::copy(data + range.first, data + range.last + 1, sent + range.first);
+		return range;
+	}
+
+private:
+	/// @cond
+	// Map rotated coordinates to raw buffer coordinates, false if off screen
+	bool toRaw(int16_t& x, int16_t& y) const
+	{
+		if (x < 0 || y < 0 || x >= _rotWidth || y >= _rotHeight)
+			return false;
+		int16_t temp;
+		switch (_rawRotation)
+		{
+			case 1:
+				temp = x;
+				x = _width - 1 - y;
+				y = temp;
+			break;
+			case 2:
+				x = _width - 1 - x;
+				y = _height - 1 - y;
+			break;
+			case 3:
+				temp = x;
+				x = y;
+				y = _height - 1 - temp;
+			break;
+		}
+		return true;
+	}
+
+	// Combine source bits into destination bits under mask
+	static uint8_t rasterOp(uint8_t destination, uint8_t source, uint8_t mask, RasterOp_e op)
+	{
+		uint8_t result = source;
+		switch (op)
+		{
+			case RasterOp_e::Copy:   result = source; break;
+			case RasterOp_e::Or:     result = destination | source; break;
+			case RasterOp_e::And:    result = destination & source; break;
+			case RasterOp_e::Xor:    result = destination ^ source; break;
+			case RasterOp_e::NotSrc: result = static_cast<uint8_t>(~source); break;
+		}
+		return static_cast<uint8_t>((destination & ~mask) | (result & mask));
+	}
+
+	// blit for rotations other than 0, one pixel at a time
+	void blitPixels(int16_t x, int16_t y, std::span<const uint8_t> image, int16_t w, int16_t h, RasterOp_e op)
+	{
+		for (int16_t cy = 0; cy < h; cy++)
+		{
+			for (int16_t cx = 0; cx < w; cx++)
+			{
+				int16_t rx = x + cx;
+				int16_t ry = y + cy;
+				if (!toRaw(rx, ry))
+					continue;
+				uint8_t source = (image[((cy / 8) * w) + cx] >> (cy & 7)) & 1;
+				uint8_t& cell = _buffer[(_stride * (ry / 8)) + rx];
+				uint8_t shift = ry & 7;
+				cell = rasterOp(cell, static_cast<uint8_t>(source << shift), static_cast<uint8_t>(1 << shift), op);
+				markDirty(ry / 8, rx, rx);
+			}
+		}
+	}
+
+	// Grow the dirty range of a page
+	void markDirty(int32_t page, int32_t first, int32_t last)
+	{
+		DirtyRange_t& range = _dirty[page];
+		if (first < range.first) range.first = static_cast<int16_t>(first);
+		if (last > range.last) range.last = static_cast<int16_t>(last);
+	}
+	/// @endcond
+
+	std::span<uint8_t> _buffer;      /**< screen buffer, empty if detached*/
+	int16_t _width = 0;              /**< raw screen width*/
+	int16_t _height = 0;             /**< raw screen height*/
+	int16_t _stride = 0;             /**< bytes per page row*/
+	int16_t _rotWidth = 0;           /**< width for the current rotation*/
+	int16_t _rotHeight = 0;          /**< height for the current rotation*/
+	uint8_t _rotation = 0;           /**< current rotation 0-3*/
+	uint8_t _rawRotation = 0;        /**< rotation after RotationMap_e applied*/
+	RotationMap_e _map = RotationMap_e::Standard; /**< rotation mapping*/
+	std::vector<DirtyRange_t> _dirty; /**< columns changed per page since last update*/
+	std::vector<uint8_t> _shadow;     /**< copy of the buffer as last sent to the screen*/
+	std::vector<bool> _sendFull;      /**< page to be sent without trimming against _shadow*/
+};
+
+// ********************** EOF *********************
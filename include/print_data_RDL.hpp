@@ -16,9 +16,11 @@
 #include <string>
 #include <vector>
 #include <array>
-#include <bitset>  // required for Binary conversion
-#include <iomanip> // required for std::setprecision 
-#include <sstream> // Required for std::ostringstream
+#include <charconv> // required for std::to_chars
+#include <type_traits>
+#include <string_view>
+#include <limits>
+#include <algorithm>
 
 /*!
 	@brief Polymorphic print class to print many data types by wrapping write function in the graphics class's
@@ -79,17 +81,7 @@ public:
 	*/
 	template <typename T>
 	size_t print(const std::vector<T> &v,  int format = defaultFormat<T>()) {
-		size_t totalWritten = 0;
-		for (const auto &element : v) {
-			std::string elementStr = formatElement(element, format);
-			totalWritten += write(elementStr.c_str(), elementStr.length());
-
-			// Add a separator space if not the last element
-			if (&element != &v.back()) {
-				totalWritten += write(" ", 1);
-			}
-		}
-		return totalWritten;
+		return printElements(v, format);
 	}
 
 	/*!
@@ -120,7 +112,7 @@ public:
 	template <typename T, size_t N>
 	size_t print(const std::array<T, N> &arr, int format = defaultFormat<T>()) 
 	{
-		return print(std::vector<T>(arr.begin(), arr.end()), format);
+		return printElements(arr, format);
 	}
 	
 		/*!
@@ -151,50 +143,114 @@ private:
 	int _ErrorFlag; /**< class Error flag , zero no error*/
 	size_t printNumber(unsigned long, uint8_t);
 	size_t printFloat(double, uint8_t);
+	static void toUpperDigits(char *first, char *last);
+
+/*!
+	@brief Called from vector and array templates, print elements separated by a space
+	@tparam Range_T vector or array type
+	@param range The elements to print
+	@param format Format specifier
+	@return Number of characters written
+*/
+template <typename Range_T>
+size_t printElements(const Range_T &range, int format) {
+	size_t totalWritten = 0;
+	bool first = true;
+	for (const auto &element : range) {
+		// Add a separator space between elements
+		if (!first) {
+			totalWritten += write(" ", 1);
+		}
+		first = false;
+		totalWritten += printElement(element, format);
+	}
+	return totalWritten;
+}
 
 
 /*!
-	@brief Called from vector template Format an element based on its type and the format parameter
+	@brief Called from vector template, format an element based on its type and the format parameter
 	@tparam T Type of the element
 	@param element The element to format
 	@param format Format specifier
-	@return Formatted string representation of the element
+	@return Number of characters written
+	@details Formats with std::to_chars into a stack buffer, then one bulk write.
+		Output matches std::ostream: negative integers in HEX OCT BIN print as
+		their unsigned two's complement, character types print as characters.
 */
 template <typename T>
-std::string formatElement(const T &element, int format) {
-	std::ostringstream oss;
-
+size_t printElement(const T &element, int format) {
+	if constexpr (std::is_same_v<T, char> || std::is_same_v<T, signed char> || std::is_same_v<T, unsigned char>) {
+		if (format != RDL_BIN) {
+			return write(static_cast<uint8_t>(element));
+		}
+	}
 	if constexpr (std::is_integral_v<T>) {
-		// Handle integral types with base conversion
-		switch (format) {
-			case RDL_DEC:
-				oss << element; // Decimal
-				break;
-			case RDL_HEX:
-				oss << std::hex << std::uppercase << element; // Hexadecimal
-				break;
-			case RDL_OCT:
-				oss << std::oct << element; // Octal
-				break;
-			case RDL_BIN: {
-				// Binary conversion using std::bitset without leading zeros
-				std::string binary = std::bitset<sizeof(T) * 8>(element).to_string();
-				binary.erase(0, binary.find_first_not_of('0')); // Strip leading zeros
-				oss << (binary.empty() ? "0" : binary); // Handle the case for 0
-				break;
+		char buf[8 * sizeof(T) + 1]; // base 2 worst case, or sign + decimal digits
+		char *end = buf;
+		if constexpr (std::is_same_v<T, bool>) {
+			end = std::to_chars(buf, buf + sizeof(buf), static_cast<unsigned int>(element)).ptr;
+		} else {
+			using Unsigned_T = std::make_unsigned_t<T>;
+			switch (format) {
+				case RDL_HEX:
+					end = std::to_chars(buf, buf + sizeof(buf), static_cast<Unsigned_T>(element), 16).ptr;
+					toUpperDigits(buf, end);
+					break;
+				case RDL_OCT:
+					end = std::to_chars(buf, buf + sizeof(buf), static_cast<Unsigned_T>(element), 8).ptr;
+					break;
+				case RDL_BIN: // no leading zeros
+					end = std::to_chars(buf, buf + sizeof(buf), static_cast<Unsigned_T>(element), 2).ptr;
+					break;
+				default: // Default to decimal
+					end = std::to_chars(buf, buf + sizeof(buf), element).ptr;
+					break;
 			}
-			default:
-				oss << element; // Default to decimal
 		}
+		return write(buf, end - buf);
 	} else if constexpr (std::is_floating_point_v<T>) {
-		// Handle floating-point types with fixed precision
-		oss << std::fixed << std::setprecision(format) << element;
+		// Fixed precision, as std::fixed with std::setprecision
+		int precision = (format < 0) ? 6 : format;
+		char buf[128];
+		auto result = std::to_chars(buf, buf + sizeof(buf), element, std::chars_format::fixed, precision);
+		if (result.ec == std::errc()) {
+			return write(buf, result.ptr - buf);
+		}
+		return printFixedWide(element, precision);
+	} else if constexpr (std::is_convertible_v<const T &, std::string_view>) {
+		std::string_view text(element);
+		return write(text.data(), text.size());
 	} else {
-		// Handle other types (fallback)
-		oss << element;
+		static_assert(std::is_arithmetic_v<T>, "print vector: unsupported element type");
+		return 0;
 	}
+}
 
-	return oss.str();
+/*!
+	@brief Called from printElement, fixed point format of values or precisions too wide for its buffer
+	@tparam T floating point type
+	@param element The value to format
+	@param precision Number of decimal places
+	@return Number of characters written
+	@details Any finite value has at most digits - min_exponent decimal places in its exact
+		expansion, 1074 for double, so the stack buffer holds every value exactly.
+		Decimal places past that are always zero and are written in chunks.
+		Kept out of printElement so only this call uses the large stack frame.
+*/
+template <typename T>
+size_t printFixedWide(T element, int precision) {
+	constexpr int PlacesMax = std::numeric_limits<T>::digits - std::numeric_limits<T>::min_exponent;
+	// sign + integer digits + point + every exact decimal place
+	char buf[1 + std::numeric_limits<T>::max_exponent10 + 1 + 1 + PlacesMax];
+	const int places = std::min(precision, PlacesMax);
+	auto result = std::to_chars(buf, buf + sizeof(buf), element, std::chars_format::fixed, places);
+	size_t written = write(buf, result.ptr - buf);
+	static constexpr char Zeros[] = "0000000000000000000000000000000000000000000000000000000000000000";
+	for (int remaining = precision - places; remaining > 0; remaining -= sizeof(Zeros) - 1) {
+		written += write(Zeros, std::min<size_t>(remaining, sizeof(Zeros) - 1));
+	}
+	return written;
 }
 
 	/*!
@@ -0,0 +1,121 @@
+/*!
+	@file     render_queue_RDL.hpp
+	@author   Gavin Lyons
+	@brief    Library header file for the asynchronous render queue of 16 bit color displays.
+				Draw calls are encoded into a lock-free ring of compact commands
+				and executed by a display thread that owns the transport.
+*/
+
+#pragma once
+
+// Includes
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include "common_data_RDL.hpp"
+#include "color16_graphics_RDL.hpp"
+
+/*!
+	@brief Class to queue draw calls for a 16 bit color display and run them on a display thread
+	@details The ring is a bounded multi producer queue, each cell carries a sequence number
+		so producers and the display thread never take a lock. Any thread may call the
+		draw methods, they return as soon as the command is in the ring.
+		The display object must only be used through the queue while it is running.
+*/
+class render_queue {
+
+public:
+
+	/*! What a producer does when the ring is full */
+	enum class Backpressure_e : uint8_t
+	{
+		Block = 0,      /**< Wait for the display thread to free a cell: default*/
+		DropOldest = 1, /**< Discard the oldest queued command to make room*/
+		Coalesce = 2    /**< Skip a flush with a newer one queued behind it, otherwise Block*/
+	};
+
+	/*! User function run on the display thread, see post() */
+	using CustomFunc_t = void (*)(color16_graphics& display, void* context);
+
+	render_queue(color16_graphics& display, size_t capacity = 256, Backpressure_e policy = Backpressure_e::Block);
+	~render_queue();
+
+	render_queue(const render_queue&) = delete;
+	render_queue& operator=(const render_queue&) = delete;
+
+	rdlib::Return_Codes_e start(void);
+	void stop(void);
+	bool isRunning(void) const;
+
+	// Draw commands
+	rdlib::Return_Codes_e drawPixel(uint16_t x, uint16_t y, uint16_t color);
+	rdlib::Return_Codes_e drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+	rdlib::Return_Codes_e drawRectWH(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+	rdlib::Return_Codes_e fillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+	rdlib::Return_Codes_e fillScreen(uint16_t color);
+	rdlib::Return_Codes_e setCursor(int16_t x, int16_t y);
+	rdlib::Return_Codes_e setTextColor(uint16_t color, uint16_t bgColor);
+	rdlib::Return_Codes_e print(const char* text);
+	rdlib::Return_Codes_e post(CustomFunc_t func, void* context);
+	rdlib::Return_Codes_e flush(void);
+	rdlib::Return_Codes_e flushAndWait(void);
+
+	// Statistics
+	uint32_t getDroppedCount(void) const;
+	uint32_t getCoalescedCount(void) const;
+	Backpressure_e getBackpressure(void) const;
+
+private:
+/// @cond
+	/*! Render command op codes */
+	enum class RenderOp_e : uint8_t
+	{
+		Pixel, Line, Rect, FillRect, FillScreen, Cursor, TextColor, Text, Flush, Custom
+	};
+
+	static constexpr size_t TEXT_CHUNK_SIZE = 24; /**< chars carried by one Text command*/
+
+	/*! One compact command, no heap storage */
+	struct RenderCommand_t
+	{
+		RenderOp_e op;
+		uint16_t color;
+		uint16_t bgColor;
+		int16_t a, b, c, d;
+		CustomFunc_t func;
+		void* context;
+		char text[TEXT_CHUNK_SIZE + 1];
+	};
+
+	/*! Ring cell, sequence number tells producers and consumer who owns it */
+	struct Cell_t
+	{
+		std::atomic<size_t> sequence;
+		RenderCommand_t cmd;
+	};
+
+	rdlib::Return_Codes_e enqueue(const RenderCommand_t& cmd);
+	bool tryPush(const RenderCommand_t& cmd);
+	bool tryPop(RenderCommand_t& cmd);
+	void execute(const RenderCommand_t& cmd);
+	void displayThread(void);
+/// @endcond
+
+	color16_graphics& _display;               /**< display owned by the display thread*/
+	Backpressure_e _policy;                   /**< full ring policy*/
+	size_t _mask = 0;                         /**< capacity - 1, capacity is a power of 2*/
+	std::unique_ptr<Cell_t[]> _cells;         /**< ring storage*/
+	alignas(64) std::atomic<size_t> _enqueuePos{0}; /**< next cell to write*/
+	alignas(64) std::atomic<size_t> _dequeuePos{0}; /**< next cell to read*/
+	alignas(64) std::atomic<uint64_t> _acceptedCount{0};  /**< commands accepted into ring*/
+	alignas(64) std::atomic<uint64_t> _completedCount{0}; /**< commands executed or dropped*/
+	std::atomic<uint32_t> _wakeCounter{0};    /**< bumped to wake the display thread*/
+	std::atomic<int32_t> _flushesQueued{0};   /**< Flush commands in the ring, may dip below 0 briefly*/
+	std::atomic<bool> _running{false};        /**< display thread running*/
+	std::atomic<uint32_t> _droppedCount{0};   /**< commands discarded by DropOldest*/
+	std::atomic<uint32_t> _coalescedCount{0}; /**< flushes skipped by Coalesce*/
+	std::thread _thread;                      /**< display thread*/
+};
+
+// ********************** EOF *********************
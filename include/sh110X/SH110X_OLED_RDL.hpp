@@ -12,6 +12,8 @@
 #include <cstdio>
 #include <cstdint>
 #include <cstdbool>
+#include <algorithm>
+#include <atomic>
 #include <lgpio.h>
 #include "bicolor_graphics_RDL.hpp"
 
@@ -22,7 +24,7 @@
 class SH110X_RDL : public bicolor_graphics  {
   public:
 	SH110X_RDL(int16_t oledwidth, int16_t oledheight);
-	~SH110X_RDL(){};
+	~SH110X_RDL(){commitAsyncEnd();};
 	
 	const uint8_t SH110X_RDL_ADDR = 0x3C; /**< I2C address */
 
@@ -33,7 +35,6 @@ class SH110X_RDL : public bicolor_graphics  {
 		SH1107_IC  =1  /**< Sh1107 controller */
 	};
 
-	virtual void drawPixel(int16_t x, int16_t y, uint8_t color) override;
 
 	rdlib::Return_Codes_e OLEDSetBufferPtr(uint8_t width, uint8_t height , std::span<uint8_t> buffer);
 	rdlib::Return_Codes_e OLEDupdate(void);
@@ -61,6 +62,8 @@ class SH110X_RDL : public bicolor_graphics  {
 	void OLEDI2CErrorTimeoutSet(uint16_t);
 	uint8_t OLEDI2CErrorRetryNumGet(void);
 	void OLEDI2CErrorRetryNumSet(uint8_t);
+	uint16_t OLEDI2CChunkSizeGet(void);
+	void OLEDI2CChunkSizeSet(uint16_t);
 
   protected:
 	
@@ -69,6 +72,10 @@ class SH110X_RDL : public bicolor_graphics  {
   private:
 
 	void I2CWriteByte(uint8_t value = 0x00, uint8_t DataOrCmd = SH110X_COMMAND_BYTE);
+	void I2CWriteData(std::span<const uint8_t> data);
+	rdlib::Return_Codes_e sendFrame(std::span<const uint8_t> frame,
+		std::span<const page_buffer_1bpp::DirtyRange_t> dirty) override;
+	void I2CWriteRetry(char* buffer, int length);
 	void SH1106_begin(void);
 	void SH1107_begin(void);
 
@@ -78,7 +85,10 @@ class SH110X_RDL : public bicolor_graphics  {
 	int _OLEDI2CHandle = 0;  /**< A number referencing an object opened by one of lgI2cOpen */
 	uint16_t _I2C_ErrorDelay = 100; /**<I2C delay(in between retry attempts) in event of error in mS*/
 	uint8_t _I2C_ErrorRetryNum = 3; /**< In event of I2C error number of retry attempts*/
-	int _I2C_ErrorFlag = 0; /**< In event of I2C error holds lgpio error code*/
+	std::atomic<int> _I2C_ErrorFlag{0}; /**< In event of I2C error holds lgpio error code, atomic as the commit thread writes it*/
+	std::atomic<bool> _I2CWriteFailed{false}; /**< set by any failed I2C write, cleared by sendFrame before it sends*/
+	static constexpr uint16_t I2C_CHUNK_MAX = 256; /**< Max data bytes in one I2C write, after the control byte*/
+	uint16_t _I2CChunkSize = I2C_CHUNK_MAX; /**< Data bytes per I2C write, lower for adapters with a small transfer limit*/
 
 	uint8_t _OLED_WIDTH=128;      /**< Width of OLED Screen in pixels */
 	uint8_t _OLED_HEIGHT=64;    /**< Height of OLED Screen in pixels */
@@ -0,0 +1,122 @@
+/*!
+	@file     spi_bus_arbiter_RDL.hpp
+	@author   Gavin Lyons
+	@brief    Library header file for sharing one SPI bus between several displays
+				driven from separate threads.
+*/
+
+#pragma once
+
+// Includes
+#include <cstdint>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include "common_data_RDL.hpp"
+
+/*!
+	@brief Class to arbitrate access to a SPI bus shared by several displays
+	@details Displays on the same /dev/spidev register with one arbiter. Each
+		DC + SPI data sequence is then run while holding the bus, so sequences from
+		display threads never interleave. The lock is recursive for the owning thread,
+		so a whole frame update can hold the bus across many sequences.
+		Waiting devices are granted the bus in arrival order (Fair) or highest
+		priority first, arrival order within a priority (Priority).
+*/
+class spi_bus_arbiter {
+
+public:
+
+	/*! Scheduling policy between devices waiting on the bus */
+	enum class Policy_e : uint8_t
+	{
+		Fair = 0,    /**< First come first served: default*/
+		Priority = 1 /**< Highest device priority first, then first come first served*/
+	};
+
+	spi_bus_arbiter(Policy_e policy = Policy_e::Fair);
+	~spi_bus_arbiter(){};
+
+	spi_bus_arbiter(const spi_bus_arbiter&) = delete;
+	spi_bus_arbiter& operator=(const spi_bus_arbiter&) = delete;
+
+	int registerDevice(uint8_t priority = 0);
+	void acquire(int deviceID);
+	void release(int deviceID);
+	void setPolicy(Policy_e policy);
+	Policy_e getPolicy(void) const;
+	uint32_t getTransactionCount(int deviceID);
+
+	/*!
+		@brief RAII guard holding the bus for one transaction
+		@details A null bus pointer makes the guard a no-op,
+			so drivers not sharing a bus pay only a branch.
+	*/
+	class Transaction {
+	public:
+		/*!
+			@brief acquire the bus
+			@param bus pointer to arbiter or nullptr
+			@param deviceID ID returned by registerDevice
+		*/
+		Transaction(spi_bus_arbiter* bus, int deviceID) : _bus(bus), _deviceID(deviceID)
+		{
+			if (_bus != nullptr) _bus->acquire(_deviceID);
+		}
+		/*! @brief release the bus */
+		~Transaction()
+		{
+			if (_bus != nullptr) _bus->release(_deviceID);
+		}
+		Transaction(const Transaction&) = delete;
+		Transaction& operator=(const Transaction&) = delete;
+	private:
+		spi_bus_arbiter* _bus; /**< bus held, or nullptr*/
+		int _deviceID;         /**< device holding the bus*/
+	};
+
+private:
+/// @cond
+	/*! A device thread waiting for the bus */
+	struct Waiter_t
+	{
+		uint64_t ticket;  /**< arrival order*/
+		uint8_t priority; /**< device priority*/
+	};
+	bool isNextWaiter(uint64_t ticket) const;
+/// @endcond
+
+	Policy_e _policy = Policy_e::Fair;  /**< current scheduling policy*/
+	std::mutex _mutex;                  /**< guards all members below*/
+	std::condition_variable _cond;      /**< signalled when bus is released*/
+	std::thread::id _ownerThread{};     /**< thread holding the bus, default id if free*/
+	uint32_t _ownerDepth = 0;           /**< recursion depth of owner thread*/
+	uint64_t _nextTicket = 0;           /**< next arrival ticket*/
+	std::vector<Waiter_t> _waiters;     /**< threads waiting for the bus*/
+	std::vector<uint8_t> _priorities;   /**< priority of each registered device*/
+	std::vector<uint32_t> _transactions;/**< transactions granted per registered device*/
+};
+
+/*!
+	@brief Mixin class for display drivers that can share a SPI bus
+*/
+class spi_bus_device {
+
+public:
+	rdlib::Return_Codes_e SPIBusAttach(spi_bus_arbiter& bus, uint8_t priority = 0);
+	void SPIBusDetach(void);
+	spi_bus_arbiter* SPIBusGet(void) const;
+
+protected:
+	/*!
+		@brief Hold the shared bus, if attached, until the returned guard goes out of scope
+		@return transaction guard
+	*/
+	spi_bus_arbiter::Transaction SPIBusLock(void) {return spi_bus_arbiter::Transaction(_spiBus, _spiBusID);}
+
+	spi_bus_arbiter* _spiBus = nullptr; /**< shared bus arbiter, nullptr if bus not shared*/
+	int _spiBusID = -1;                 /**< device ID on shared bus*/
+};
+
+// ********************** EOF *********************
@@ -13,6 +13,8 @@
 #include <cstdio>
 #include <cstdint>
 #include <cstdbool>
+#include <algorithm>
+#include <atomic>
 #include <lgpio.h>
 #include "bicolor_graphics_RDL.hpp"
 
@@ -23,7 +25,7 @@
 class SSD1306_RDL : public bicolor_graphics  {
   public:
 	SSD1306_RDL(int16_t oledwidth, int16_t oledheight);
-	~SSD1306_RDL(){};
+	~SSD1306_RDL(){commitAsyncEnd();};
 
 	/*! @brief Enum to control controller type */
 	enum class OLED_Controller_e {
@@ -31,7 +33,6 @@ class SSD1306_RDL : public bicolor_graphics  {
 		SSD1315  /**< SSD1315 controller */
 	};
 
-	virtual void drawPixel(int16_t x, int16_t y, uint8_t color) override;
 
 	rdlib::Return_Codes_e OLEDSetBufferPtr(uint8_t width, uint8_t height , std::span<uint8_t> buffer);
 	rdlib::Return_Codes_e OLEDupdate(void);
@@ -63,6 +64,8 @@ class SSD1306_RDL : public bicolor_graphics  {
 	void OLEDI2CErrorTimeoutSet(uint16_t);
 	uint8_t OLEDI2CErrorRetryNumGet(void);
 	void OLEDI2CErrorRetryNumSet(uint8_t);
+	uint16_t OLEDI2CChunkSizeGet(void);
+	void OLEDI2CChunkSizeSet(uint16_t);
 
 	static constexpr uint8_t SSD1306_ADDR = 0x3C;  /**< I2C address, alt 0x3D */
 	static constexpr uint8_t SSD1315_ADDR = 0x3C; /**<  I2C address, alt 0x3D */
@@ -70,6 +73,11 @@ class SSD1306_RDL : public bicolor_graphics  {
   private:
 
 	void I2CWriteByte(uint8_t value = 0x00, uint8_t DataOrCmd =  SSD1306_COMMAND);
+	void I2CWriteData(std::span<const uint8_t> data);
+	void I2CWriteRetry(char* buffer, int length);
+	void I2CSetWindow(uint8_t colFirst, uint8_t colLast, uint8_t pageFirst, uint8_t pageLast);
+	rdlib::Return_Codes_e sendFrame(std::span<const uint8_t> frame,
+		std::span<const page_buffer_1bpp::DirtyRange_t> dirty) override;
 	//  === SSD1306 Command Set  ===
 	// Fundamental Commands
 	static constexpr uint8_t SSD1306_SET_CONTRAST_CONTROL = 0x81;  /**< Set Contrast Control */
@@ -126,7 +134,10 @@ class SSD1306_RDL : public bicolor_graphics  {
 	int _OLEDI2CHandle = 0;  /**< A number referencing an object opened by one of lgI2cOpen */
 	uint16_t _I2C_ErrorDelay = 100; /**<I2C delay(in between retry attempts) in event of error in mS*/
 	uint8_t _I2C_ErrorRetryNum = 3; /**< In event of I2C error number of retry attempts*/
-	int _I2C_ErrorFlag = 0; /**< In event of I2C error holds code*/
+	std::atomic<int> _I2C_ErrorFlag{0}; /**< In event of I2C error holds code, atomic as the commit thread writes it*/
+	std::atomic<bool> _I2CWriteFailed{false}; /**< set by any failed I2C write, cleared by sendFrame before it sends*/
+	static constexpr uint16_t I2C_CHUNK_MAX = 256; /**< Max data bytes in one I2C write, after the control byte*/
+	uint16_t _I2CChunkSize = I2C_CHUNK_MAX; /**< Data bytes per I2C write, lower for adapters with a small transfer limit*/
 
 	uint8_t _OLED_WIDTH=128;      /**< Width of OLED Screen in pixels */
 	uint8_t _OLED_HEIGHT=64;    /**< Height of OLED Screen in pixels */
@@ -48,6 +48,7 @@ public:
 	void TFTpartialDisplay(bool m);
 	void TFTenableDisplay(bool m);
 	void TFTidleDisplay(bool m);
+	void TFTtearingEffect(bool m);
 	void TFTsleepDisplay(bool m);
 	void TFTNormalMode(void);
 	void TFTsetScrollDefinition(uint16_t th, uint16_t tb, bool sd);
@@ -104,6 +105,8 @@ private:
 	static constexpr uint8_t ST7789_RAMRD    = 0x2E; /**< Memory read */
 	static constexpr uint8_t ST7789_PTLAR    = 0x30; /**< Partial Area */
 	static constexpr uint8_t ST7789_VSCRDEF  = 0x33; /**< Vertical scroll def */
+	static constexpr uint8_t ST7789_TEOFF    = 0x34; /**< Tearing effect line off */
+	static constexpr uint8_t ST7789_TEON     = 0x35; /**< Tearing effect line on */
 	static constexpr uint8_t ST7789_SRLBTT   = 0x28; /**< Scroll direction bottom to top */
 	static constexpr uint8_t ST7789_SRLTTB   = 0x30; /**< Scroll direction top to bottom */
 	static constexpr uint8_t ST7789_COLMOD   = 0x3A; /**< Interface Pixel Format */
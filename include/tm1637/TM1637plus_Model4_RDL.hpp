@@ -12,6 +12,8 @@
 #include <cstring>  // for strlen
 #include "common_data_RDL.hpp"
 #include "led_segment_font_data_RDL.hpp"
+#include "led_segment_shadow_RDL.hpp"
+#include "bitbang_bus_RDL.hpp"
 
 
 /*!
@@ -28,6 +30,8 @@ public:
 	rdlib::Return_Codes_e displayClose(void);
 	void displayClear(void);
 	void setBrightness(uint8_t brightness, bool on );
+	void invalidateShadow(void);
+	uint8_t getDisplaySize(void) const;
 
 	void setSegments(const uint8_t segments[], uint8_t length , uint8_t pos );
 	void DisplayDecimal(int num, bool leading_zero, uint8_t length , uint8_t pos );
@@ -45,16 +49,24 @@ private:
 	uint8_t _DisplaySize = 4; /**< size of display in digits */
 	int _DeviceNumGpioChip = 0; /**< The device number of a gpiochip usually 0 , ls /dev/gpio */
 	int _GpioHandle = 0; /**< This returns a handle to a gpiochip device. */
+	bitbang_bus _bus; /**< CLK and DIO lines, open drain */
 
 	// Misc 
 	int _BitDelayUS = 75; /**< Us second delay used in communications */
 	uint8_t _brightness = 7; /**< Brightness level 0-7*/
 	const uint8_t _ASCIIOffset = 0x20; /**< Offset in the ASCII table for font Start position */
+	const uint8_t _ASCIIEnd = 0x7B; /**< last character+1 in the font, 'z' */
 
 	// Tm1637 Command list
 	static constexpr uint8_t TM1637_COMMAND_1 = 0x40; /**< Automatic data incrementing */
 	static constexpr uint8_t TM1637_COMMAND_2 = 0xC0; /**< Data Data1~N: Transfer display data */
 	static constexpr uint8_t TM1637_COMMAND_3 = 0x80; /**< Display intensity */
+	static constexpr uint8_t TM1637_MAX_DIGITS = 6;   /**< Display RAM bytes, grids 1-6 */
+
+	// Shadow of display RAM
+	led_segment_shadow _displayRAM{TM1637_MAX_DIGITS}; /**< digits as last sent to the display */
+	uint8_t _brightnessSent = 0xFF; /**< brightness command last sent, 0xFF none */
+	static constexpr uint8_t _ShadowMaxGap = 2; /**< unchanged digits resent to join two bursts */
 
 	void CommBitDelay(void);
 	void CommStart(void);
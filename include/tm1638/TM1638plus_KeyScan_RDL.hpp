@@ -0,0 +1,123 @@
+/*!
+	@file     TM1638plus_KeyScan_RDL.hpp
+	@author   Gavin Lyons
+	@brief    RPI library Tm1638plus, Header file for the background key scanner of the TM1638 modules.
+				A scanner thread owns the bus, reads the keys at a fixed rate, debounces them
+				and runs queued display writes between key reads.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "TM1638plus_Model1_RDL.hpp"
+#include "TM1638plus_Model2_RDL.hpp"
+
+/*!
+	@brief Class to scan the keys of a TM1638 module on a background thread
+	@details While running the scanner thread is the only user of the STB, CLK and DIO lines.
+		Display writes are posted as functions and run on the scanner thread between key reads,
+		so they never collide with a key read. Key changes are debounced in software and
+		delivered as press, release and long press events through a lock-free single consumer
+		queue. An eventfd is readable while events are queued, for use with poll or epoll.
+*/
+class TM1638plus_KeyScan {
+
+public:
+
+	/*! Type of key event */
+	enum class KeyEvent_e : uint8_t
+	{
+		Press = 1,     /**< Key went down, after debounce*/
+		Release = 2,   /**< Key went up, after debounce*/
+		LongPress = 3  /**< Key held down for the long press time, sent once per press*/
+	};
+
+	/*! One key event */
+	struct KeyEvent_t
+	{
+		uint8_t key = 0;                     /**< Key number 1-8 Model 1 and 3, 1-16 Model 2*/
+		KeyEvent_e event = KeyEvent_e::Press; /**< Type of event*/
+		uint32_t timeMs = 0;                 /**< Time of event in mS since start()*/
+	};
+
+	/*! Display write run on the scanner thread, see post() */
+	using DisplayFunc_t = std::function<void(void)>;
+
+	TM1638plus_KeyScan(TM1638plus_Model1& display, size_t capacity = 32);
+	TM1638plus_KeyScan(TM1638plus_Model2& display, size_t capacity = 32);
+	~TM1638plus_KeyScan();
+
+	TM1638plus_KeyScan(const TM1638plus_KeyScan&) = delete;
+	TM1638plus_KeyScan& operator=(const TM1638plus_KeyScan&) = delete;
+
+	rdlib::Return_Codes_e start(void);
+	void stop(void);
+	bool isRunning(void) const;
+
+	// Settings, change while stopped
+	rdlib::Return_Codes_e setScanPeriod(uint16_t periodMs);
+	rdlib::Return_Codes_e setDebounce(uint8_t samples);
+	rdlib::Return_Codes_e setLongPress(uint16_t longPressMs);
+
+	// Display writes
+	rdlib::Return_Codes_e post(DisplayFunc_t func);
+
+	// Key events
+	bool getEvent(KeyEvent_t& event);
+	bool waitEvent(KeyEvent_t& event, int timeoutMs);
+	int getEventFd(void) const;
+	uint16_t getKeys(void) const;
+	uint32_t getDroppedCount(void) const;
+
+private:
+/// @cond
+	using ScanClock_t = std::chrono::steady_clock;
+	static constexpr uint8_t MaxKeys = 16;
+
+	TM1638plus_KeyScan(std::function<uint16_t(void)> readKeys, uint8_t numKeys, size_t capacity);
+	bool pushEvent(uint8_t key, KeyEvent_e type);
+	void debounce(uint16_t raw);
+	void runPosted(void);
+	void scanThread(void);
+/// @endcond
+
+	std::function<uint16_t(void)> _readKeys; /**< reads the raw key bit mask from the module*/
+	uint8_t _numKeys;                        /**< keys on the module, 8 or 16*/
+	uint16_t _scanPeriodMs = 10;             /**< time between key reads*/
+	uint8_t _debounceSamples = 3;            /**< equal reads needed to accept a key change*/
+	uint16_t _longPressMs = 1000;            /**< hold time for a LongPress event, 0 off*/
+
+	// Debounce state, scanner thread only
+	uint16_t _stableKeys = 0;                /**< debounced key state*/
+	uint8_t _changeCount[MaxKeys] = {0};     /**< reads a key has differed from its stable state*/
+	uint32_t _pressTimeMs[MaxKeys] = {0};    /**< time the key was pressed*/
+	uint16_t _longSent = 0;                  /**< keys whose LongPress was sent*/
+	ScanClock_t::time_point _startTime{};    /**< time of start()*/
+
+	// Event ring, single producer single consumer
+	size_t _mask = 0;                        /**< capacity - 1, capacity is a power of 2*/
+	std::unique_ptr<KeyEvent_t[]> _events;   /**< ring storage*/
+	alignas(64) std::atomic<size_t> _head{0}; /**< next event to write, scanner thread*/
+	alignas(64) std::atomic<size_t> _tail{0}; /**< next event to read, consumer*/
+	std::atomic<uint16_t> _keys{0};          /**< debounced key state for getKeys()*/
+	std::atomic<uint32_t> _droppedCount{0};  /**< events lost to a full ring*/
+	int _eventFd = -1;                       /**< eventfd, counts queued events*/
+
+	// Posted display writes
+	std::mutex _postMutex;                   /**< guards _posted, _wake and the running to stopped change*/
+	std::condition_variable _postCond;       /**< wakes the scanner thread for a post or stop*/
+	std::vector<DisplayFunc_t> _posted;      /**< display writes waiting to run*/
+	bool _wake = false;                      /**< set with _postCond*/
+	std::atomic<bool> _running{false};       /**< scanner thread running*/
+	std::thread _thread;                     /**< scanner thread*/
+};
+
+// ********************** EOF *********************
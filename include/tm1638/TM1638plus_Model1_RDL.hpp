@@ -24,6 +24,7 @@ public:
 	void displayASCIIwDot(uint8_t position, uint8_t ascii) ;
 	void displayHex(uint8_t position, uint8_t hex);
 	void display7Seg(uint8_t position, uint8_t value);
+	void setSegments(const uint8_t segments[], uint8_t length, uint8_t position);
 	void displayIntNum(unsigned long number, AlignTextType_e = TMAlignTextLeft);
 	void DisplayDecNumNibble(uint16_t numberUpper, uint16_t numberLower,AlignTextType_e = TMAlignTextLeft);
 	
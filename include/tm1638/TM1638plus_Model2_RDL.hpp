@@ -31,6 +31,8 @@ public:
 
 private:
 
+	void stageSegments(uint8_t segment, uint8_t digit);
+
 	bool _SWAP_NIBBLES= false; /**< Swap the nibbles on display byte */
 
 };
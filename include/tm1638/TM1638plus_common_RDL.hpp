@@ -15,6 +15,8 @@
 #include <lgpio.h>
 #include "common_data_RDL.hpp"
 #include "led_segment_font_data_RDL.hpp"
+#include "led_segment_shadow_RDL.hpp"
+#include "bitbang_bus_RDL.hpp"
 
 
 /*!
@@ -36,6 +38,7 @@ public:
 	enum TMOffsetsMasks : uint8_t
 	{
 		TM_ASCII_OFFSET = 0x20, /**< 32 Ascii table offset to jump over first missing 32 chars */
+		TM_ASCII_END    = 0x7B, /**< last character+1 in the font, 'z' */
 		TM_HEX_OFFSET   = 0x10, /**< 16 Ascii table offset to reach number position */
 		TM_DOT_MASK_DEC = 0x80, /**< 128  Mask to  switch on decimal point in seven seg. */
 		TM_BRIGHT_MASK = 0x07 /**< Brightness mask */
@@ -51,12 +54,16 @@ public:
 	uint16_t TMCommDelayGet(void);
 	void TMCommDelayset(uint16_t);
 	rdlib::Return_Codes_e displayClose(void);
+	void invalidateShadow(void);
+	void commitFrame(void);
+	unsigned char encodeCharacter(unsigned char character);
 
 protected:
 	void sendCommand(uint8_t value);
 	void sendData(uint8_t  data);
 	uint8_t  HighFreqshiftin(void);
 	void HighFreqshiftOut(uint8_t val);
+	void writeDisplayRAM(void);
 
 	/*! Tm1638 register commands*/
 	enum TMCommands : uint8_t
@@ -76,8 +83,13 @@ protected:
 	const uint8_t _TMDisplaySize = 8; /**< size of display in digts */
 	int _DeviceNumGpioChip = 0; /**< The device number of a gpiochip ls /dev/gpio */
 	int _GpioHandle = 0; /**< This returns a handle to a gpiochip device. */
+	static constexpr uint8_t _TMDisplayRAMSize = 16; /**< display RAM bytes, segment address even, LED address odd */
+	led_segment_shadow _displayRAM{_TMDisplayRAMSize}; /**< shadow of display RAM, stage then writeDisplayRAM() or commitFrame() */
+	bitbang_bus _bus; /**< CLK and DIO lines, DIO switched to input to read buttons */
 
 private:
+	bool sendBurst(size_t first, std::span<const uint8_t> data);
+	static constexpr uint8_t _TMShadowMaxGap = 2; /**< unchanged bytes resent to join two bursts, a new burst costs two bytes */
 	uint16_t _TMCommDelay = 1; /**<  uS delay used in communications , User adjust */
 	const uint8_t _TMDefaultBrightness = 0x02; /**<  can be 0x00 to 0x07 , User adjust */
 
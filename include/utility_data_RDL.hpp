@@ -23,6 +23,13 @@
 #include <cstdlib>
 #include <filesystem>
 #include <cmath>  // For std::cos, std::sin  std::lerp
+#include <cstdio>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <string_view>
 
 /*! @brief Name space for config file related utilities*/
 namespace rdlib_config 
@@ -31,6 +38,7 @@ namespace rdlib_config
 	bool isLoggingEnabled();
 	bool isDebugEnabled();
 	std::string getErrorLogPath();
+	uintmax_t getErrorLogMaxBytes();
 }
 
 /*! @brief Name space for maths related utilities*/
@@ -49,6 +57,80 @@ namespace rdlib_log
 
 std::ostream& operator<<(std::ostream& os, const std::source_location& location);
 
+/*!
+	@brief Background writer for the log file, used by logData.
+	@details Records are copied into a bounded lock-free ring and written out in batches
+		by a worker thread, which keeps the log file open. Callers never block on file IO:
+		if the ring is full the record is dropped and counted.
+		A record identical to the previous one within REPEAT_WINDOW is not queued, only counted,
+		and the count is written to the file as a repeat note. The file is rotated to "<path>.1" when it grows past
+		ERROR_LOG_MAX_BYTES from the config file.
+*/
+class asyncLogger {
+public:
+	static asyncLogger& instance();
+
+	bool submit(std::string_view record);
+	void flush();
+	uint32_t getDroppedCount() const;
+	uint32_t getSuppressedCount() const;
+
+	asyncLogger(const asyncLogger&) = delete;
+	asyncLogger& operator=(const asyncLogger&) = delete;
+
+	static constexpr size_t RING_SIZE = 256;            /**< records held in ring, power of 2*/
+	static constexpr size_t RECORD_SIZE = 480;          /**< max chars of one record, longer are truncated*/
+	static constexpr std::chrono::milliseconds BATCH_INTERVAL{50};  /**< worker wakes at least this often*/
+	static constexpr std::chrono::milliseconds REPEAT_WINDOW{1000}; /**< identical records merged within this window*/
+
+private:
+/// @cond
+	/*! One preformatted record, no heap storage */
+	struct Record_t
+	{
+		std::chrono::system_clock::time_point time;
+		uint32_t repeatsBefore;
+		uint16_t length;
+		char text[RECORD_SIZE];
+	};
+	/*! Ring cell, sequence number tells producers and worker who owns it */
+	struct Cell_t
+	{
+		std::atomic<size_t> sequence;
+		Record_t record;
+	};
+
+	asyncLogger();
+	~asyncLogger();
+	bool tryPop(Record_t& record);
+	void workerThread();
+	void writeBatch(std::string& batch);
+	void appendRecord(std::string& batch, std::chrono::system_clock::time_point time, std::string_view text);
+	void appendRepeats(std::string& batch, uint32_t repeats, std::chrono::system_clock::time_point time);
+/// @endcond
+
+	std::unique_ptr<Cell_t[]> _cells;                 /**< ring storage*/
+	alignas(64) std::atomic<size_t> _enqueuePos{0};   /**< next cell to write*/
+	alignas(64) std::atomic<size_t> _dequeuePos{0};   /**< next cell to read, worker only*/
+	std::atomic<uint64_t> _acceptedCount{0};          /**< records accepted into ring*/
+	std::atomic<uint64_t> _writtenCount{0};           /**< records taken by worker and written or merged*/
+	std::atomic<uint32_t> _droppedCount{0};           /**< records dropped, ring full*/
+	std::atomic<uint32_t> _suppressedCount{0};        /**< records merged as repeats, total*/
+	std::atomic<size_t> _lastHash{0};                 /**< hash of last record queued*/
+	std::atomic<int64_t> _lastHashTime{0};            /**< time last record was queued, system clock ticks*/
+	std::atomic<uint32_t> _repeatPending{0};          /**< repeats of last record not yet queued*/
+	std::atomic<bool> _stop{false};                   /**< worker exits when set*/
+	std::mutex _wakeMutex;                            /**< for _wakeCond only*/
+	std::condition_variable _wakeCond;                /**< wakes worker early when ring half full or on flush*/
+	// worker thread state
+	FILE* _file = nullptr;                            /**< open log file*/
+	std::string _filePath;                            /**< path _file was opened with*/
+	uintmax_t _fileBytes = 0;                         /**< current size of log file*/
+	bool _openFailReported = false;                   /**< open error printed once until next success*/
+	uint32_t _droppedReported = 0;                    /**< dropped count already written to file*/
+	std::thread _worker;                              /**< worker thread*/
+};
+
 /*!
 	@brief Exception class template for handling and logging errors.
 	@tparam DATA_T Type of additional data to store with the error.
@@ -101,23 +183,16 @@ private:
 	const std::source_location errorLocation; /**< The source location of the error.*/
 	/*!
 		@brief Logs the error message to a file.
-		If the logfile cannot be opened, an error message is printed to std::cerr.
+		@details The record is formatted here and handed to asyncLogger, which time stamps it
+		and writes it on its worker thread. Does not block on file IO.
+		If the logfile cannot be opened, an error message is printed to std::cerr by the worker.
 	*/
 	void logError() const {
-		std::ofstream logFile(rdlib_config::getErrorLogPath(), std::ios::app);
-		if (logFile) {
-			// Get current time
-			auto now = std::chrono::system_clock::now();
-			auto timeT = std::chrono::system_clock::to_time_t(now);
-			logFile << "[" << std::put_time(std::localtime(&timeT), "%Y-%m-%d %H:%M:%S") << "]\n"
-					<< "Info: " << errorString << "\n"
-					<< "Data: " << userData << "\n"
-					<< "Location: " << errorLocation << "\n"
-					<< "-----------------------------\n";
-		} else {
-			std::cerr << "Failed to open log file: " << rdlib_config::getErrorLogPath() << "\n";
-			perror("Error reason"); // Print system error message
-		}
+		std::ostringstream record;
+		record << "Info: " << errorString << "\n"
+				<< "Data: " << userData << "\n"
+				<< "Location: " << errorLocation << "\n";
+		asyncLogger::instance().submit(record.view());
 	}
 };
 
@@ -23,13 +23,24 @@ bicolor_graphics::bicolor_graphics(int16_t w, int16_t h):
 	_textwrap  = true;
 }
 
+/*!
+	@brief Destructor, stops the background buffer transfer if running
+	@note Sub classes call commitAsyncEnd in their own destructor, so no transfer
+		is running once they are destroyed.
+*/
+bicolor_graphics::~bicolor_graphics()
+{
+	commitAsyncEnd();
+}
+
 
 /*!
 	@brief Write 1 character on display
 	@param  x character starting position on x-axis.
 	@param  y character starting position on y-axis.
 	@param  value Character to be written.
-	@note Horizontal font addressing 
+	@note Horizontal font addressing. With a page buffer the glyph is blitted from a
+		column-major copy of the font, a byte column at a time at rotation 0.
 	@return Will return rdlib::Return_Codes_e enum
 		-# rdlib::Success  success
 		-# rdlib::CharScreenBounds co-ords out of bounds check x and y
@@ -52,6 +63,18 @@ rdlib::Return_Codes_e bicolor_graphics::writeChar(int16_t x, int16_t y, char val
 		return rdlib::CharFontASCIIRange;
 	}
 
+	// 3. Page buffer, blit the transposed glyph
+	if (_pageBuffer.isAttached())
+	{
+		std::span<const uint8_t> columns = getFontColumns();
+		size_t glyphSize = static_cast<size_t>(_Font_X_Size) * ((_Font_Y_Size + 7) / 8);
+		if (!columns.empty() &&
+			_pageBuffer.blit(x, y, columns.subspan((value - _FontOffset) * glyphSize, glyphSize),
+				_Font_X_Size, _Font_Y_Size,
+				getInvertFont() ? page_buffer_1bpp::RasterOp_e::NotSrc : page_buffer_1bpp::RasterOp_e::Copy))
+			return rdlib::Success;
+	}
+
 	uint16_t fontIndex = 0;
 	int16_t colByte, cx, cy;
 	int16_t colbit;
@@ -65,9 +88,9 @@ rdlib::Return_Codes_e bicolor_graphics::writeChar(int16_t x, int16_t y, char val
 		{
 			 // Check if the current bit is set
 			if ((colByte & (1 << colbit)) != 0) {
-				drawPixel(x + cx, y + cy, !getInvertFont());
+				plotPixel(x + cx, y + cy, !getInvertFont());
 			} else {
-				drawPixel(x + cx, y + cy, getInvertFont());
+				plotPixel(x + cx, y + cy, getInvertFont());
 			}
 			colbit--;
 			if (colbit < 0) {
@@ -174,10 +197,10 @@ void bicolor_graphics::drawCircle(int16_t centerX, int16_t centerY, int16_t radi
 	int16_t x = 0;
 	int16_t y = radius;
 	// Draw the initial points on the circle (4 points)
-	drawPixel(centerX, centerY + radius, color);
-	drawPixel(centerX, centerY - radius, color);
-	drawPixel(centerX + radius, centerY, color);
-	drawPixel(centerX - radius, centerY, color);
+	plotPixel(centerX, centerY + radius, color);
+	plotPixel(centerX, centerY - radius, color);
+	plotPixel(centerX + radius, centerY, color);
+	plotPixel(centerX - radius, centerY, color);
 	// Apply the circle drawing algorithm to plot points around the circle
 	while (x < y)
 	{
@@ -193,14 +216,14 @@ void bicolor_graphics::drawCircle(int16_t centerX, int16_t centerY, int16_t radi
 		deltaX += 2;
 		decisionParam += deltaX;
 		// Draw the 8 symmetrical points of the circle for each iteration
-		drawPixel(centerX + x, centerY + y, color);
-		drawPixel(centerX - x, centerY + y, color);
-		drawPixel(centerX + x, centerY - y, color);
-		drawPixel(centerX - x, centerY - y, color);
-		drawPixel(centerX + y, centerY + x, color);
-		drawPixel(centerX - y, centerY + x, color);
-		drawPixel(centerX + y, centerY - x, color);
-		drawPixel(centerX - y, centerY - x, color);
+		plotPixel(centerX + x, centerY + y, color);
+		plotPixel(centerX - x, centerY + y, color);
+		plotPixel(centerX + x, centerY - y, color);
+		plotPixel(centerX - x, centerY - y, color);
+		plotPixel(centerX + y, centerY + x, color);
+		plotPixel(centerX - y, centerY + x, color);
+		plotPixel(centerX + y, centerY - x, color);
+		plotPixel(centerX - y, centerY - x, color);
 	}
 }
 
@@ -240,23 +263,23 @@ void bicolor_graphics::drawCircleHelper( int16_t centerX, int16_t centerY,
 		// Draw the points for each corner based on the cornerFlags
 		if (cornerFlags & 0x4) // Top-right corner
 		{
-			drawPixel(centerX + x, centerY + y, color);
-			drawPixel(centerX + y, centerY + x, color);
+			plotPixel(centerX + x, centerY + y, color);
+			plotPixel(centerX + y, centerY + x, color);
 		}
 		if (cornerFlags & 0x2) // Bottom-right corner
 		{
-			drawPixel(centerX + x, centerY - y, color);
-			drawPixel(centerX + y, centerY - x, color);
+			plotPixel(centerX + x, centerY - y, color);
+			plotPixel(centerX + y, centerY - x, color);
 		}
 		if (cornerFlags & 0x8) // Top-left corner
 		{
-			drawPixel(centerX - y, centerY + x, color);
-			drawPixel(centerX - x, centerY + y, color);
+			plotPixel(centerX - y, centerY + x, color);
+			plotPixel(centerX - x, centerY + y, color);
 		}
 		if (cornerFlags & 0x1) // Bottom-left corner
 		{
-			drawPixel(centerX - y, centerY - x, color);
-			drawPixel(centerX - x, centerY - y, color);
+			plotPixel(centerX - y, centerY - x, color);
+			plotPixel(centerX - x, centerY - y, color);
 		}
 	}
 }
@@ -360,9 +383,9 @@ void bicolor_graphics::drawLine(int16_t x0, int16_t y0,
 
 	for (; x0<=x1; x0++) {
 	if (steep) {
-		drawPixel(y0, x0, color);
+		plotPixel(y0, x0, color);
 	} else {
-		drawPixel(x0, y0, color);
+		plotPixel(x0, y0, color);
 	}
 	err -= dy;
 	if (err < 0) {
@@ -398,13 +421,14 @@ void bicolor_graphics::drawRect(int16_t x, int16_t y,
 	@param color The color of the line
 	@return enum rdlib::Return_Codes_e 
 		-# rdlib::Success for success
-		-# rdlib::ShapeScreenBounds Error
+		-# rdlib::ShapeScreenBounds Error, also for h of 0 or less, nothing is drawn
 */
 rdlib::Return_Codes_e bicolor_graphics::drawFastVLine(int16_t x, int16_t y,
 				 int16_t h, uint8_t color) {
-	if ((x >= _width) || (y >= _height))
+	if ((x >= _width) || (y >= _height) || (h <= 0))
 		return rdlib::ShapeScreenBounds;
-	drawLine(x, y, x, y+h-1, color);
+	if (!pageFillRect(x, y, 1, h, color))
+		drawLine(x, y, x, y+h-1, color);
 	return rdlib::Success;
 }
 
@@ -416,13 +440,14 @@ rdlib::Return_Codes_e bicolor_graphics::drawFastVLine(int16_t x, int16_t y,
 	@param color The color of the line
 	@return enum rdlib::Return_Codes_e 
 		-# rdlib::Success for success
-		-# rdlib::ShapeScreenBounds Error
+		-# rdlib::ShapeScreenBounds Error, also for w of 0 or less, nothing is drawn
 */
 rdlib::Return_Codes_e  bicolor_graphics::drawFastHLine(int16_t x, int16_t y,
 				 int16_t w, uint8_t color) {
-	if ((x >= _width) || (y >= _height))
+	if ((x >= _width) || (y >= _height) || (w <= 0))
 		return rdlib::ShapeScreenBounds;
-	drawLine(x, y, x+w-1, y, color);
+	if (!pageFillRect(x, y, w, 1, color))
+		drawLine(x, y, x+w-1, y, color);
 	return rdlib::Success;
 }
 
@@ -433,14 +458,338 @@ rdlib::Return_Codes_e  bicolor_graphics::drawFastHLine(int16_t x, int16_t y,
 	@param w width of the rectangle
 	@param h height of the rectangle
 	@param color color to fill  rectangle
+	@note If the sub class has set a page buffer, the rectangle is written
+		8 pixels at a time as byte masks, else pixel by pixel.
+		A w or h of 0 or less draws nothing on either path.
 */
 void bicolor_graphics::fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
 				uint8_t color) {
+	if (w <= 0 || h <= 0)
+		return;
+	if (pageFillRect(x, y, w, h, color))
+		return;
 	for (int16_t i=x; i<x+w; i++) {
 	drawFastVLine(i, y, h, color);
 	}
 }
 
+/*!
+	@brief Give the graphics class direct access to the sub class screen buffer
+	@param buffer screen buffer, vertical addressed pages of 8 pixels, LSB at top
+	@param stride bytes per page row , the raw screen width in pixels
+	@param map how the display maps rotation 90 and 270 to the buffer, see page_buffer_1bpp
+	@details drawPixel, fillRect, fillScreen, drawFastHLine and drawFastVLine, and the shapes and
+		text built from them, then write straight into the buffer with no virtual call per pixel.
+		Pass an empty span to detach.
+		Ignored if buffer is smaller than stride * (HEIGHT/8) or stride is less than WIDTH.
+*/
+void bicolor_graphics::setPageBuffer(std::span<uint8_t> buffer, int16_t stride, page_buffer_1bpp::RotationMap_e map)
+{
+	_pageBuffer.attach(buffer, WIDTH, HEIGHT, stride, map);
+}
+
+/*!
+	@brief Draws a pixel into the screen buffer set by the sub class
+	@param x x co-ord of pixel
+	@param y y co-ord of pixel
+	@param color color of pixel , pixel_color_e
+	@note Final, the graphics functions write the page buffer directly and would not see an override.
+		Sub classes must set a page buffer with setPageBuffer to draw.
+*/
+void bicolor_graphics::drawPixel(int16_t x, int16_t y, uint8_t color)
+{
+	_pageBuffer.drawPixel(x, y, color);
+}
+
+/*!
+	@brief Mark the whole screen buffer to be sent on the next buffer update
+	@details The graphics functions track which pages and columns they change, the
+		buffer update of the display then sends only those. Call this after writing
+		into the buffer other than with the graphics functions, e.g. memset or memcpy.
+*/
+void bicolor_graphics::markBufferDirty(void)
+{
+	_pageBuffer.markAllDirty();
+}
+
+/*!
+	@brief Start the background buffer transfer, double buffered
+	@param policy what commitAsync does with a frame while a transfer is in flight
+	@return
+		-# rdlib::Success
+		-# rdlib::BufferEmpty no screen buffer set, call the display's buffer set function first
+		-# rdlib::MemoryAError could not allocate the frames
+	@details A thread is started that sends committed frames to the display.
+		commitAsync copies the screen buffer into a frame owned by the library and
+		returns, so the application draws the next frame while this one is sent.
+		If already started only the policy is changed.
+	@note While a transfer is in flight only draw into the buffer, call waitCommit
+		before any function that writes to the display itself.
+*/
+rdlib::Return_Codes_e bicolor_graphics::commitAsyncBegin(CommitPolicy_e policy)
+{
+	std::lock_guard<std::mutex> lock(_commitMutex);
+	_commitPolicy = policy;
+	if (_commitRunning)
+		return rdlib::Success;
+	if (!_pageBuffer.isAttached())
+	{
+		fprintf(stderr, "Error: commitAsyncBegin: Buffer is empty, set the screen buffer first\n");
+		return rdlib::BufferEmpty;
+	}
+	try
+	{
+		_frameQueued.reserve(_pageBuffer.data().size());
+		_frameInFlight.reserve(_pageBuffer.data().size());
+	}
+	catch (const std::bad_alloc&)
+	{
+		fprintf(stderr, "Error: commitAsyncBegin: Could not allocate frames\n");
+		return rdlib::MemoryAError;
+	}
+	_commitStop = false;
+	_commitQueued = false;
+	_commitResult = rdlib::Success;
+	_commitDropped = 0;
+	_commitRunning = true;
+	_commitThread = std::thread(&bicolor_graphics::commitThread, this);
+	return rdlib::Success;
+}
+
+/*!
+	@brief Stop the background buffer transfer after the committed frames are sent
+*/
+void bicolor_graphics::commitAsyncEnd(void)
+{
+	{
+		std::lock_guard<std::mutex> lock(_commitMutex);
+		if (!_commitRunning) return;
+		_commitStop = true;
+	}
+	_commitCond.notify_all();
+	if (_commitThread.joinable()) _commitThread.join();
+	std::lock_guard<std::mutex> lock(_commitMutex);
+	_commitRunning = false;
+}
+
+/*!
+	@brief Commit the screen buffer to be sent in the background, does not block
+	@return
+		-# rdlib::Success frame committed, or dropped by CommitPolicy_e::Drop
+		-# rdlib::GenericError commitAsyncBegin not called
+	@details Only the columns changed since the last commit are sent, as the display's
+		buffer update. If a transfer is in flight the frame is handled by the policy:
+		Queue keeps it to send next, replacing one already waiting;
+		Drop leaves it uncommitted, its changes are sent with the next commit.
+		Either way no change is lost, see getCommitDroppedCount.
+*/
+rdlib::Return_Codes_e bicolor_graphics::commitAsync(void)
+{
+	{
+		std::lock_guard<std::mutex> lock(_commitMutex);
+		if (!_commitRunning)
+		{
+			fprintf(stderr, "Error: commitAsync: Call commitAsyncBegin first\n");
+			return rdlib::GenericError;
+		}
+		bool busy = _commitInFlight || _commitQueued;
+		if (busy && _commitPolicy == CommitPolicy_e::Drop)
+		{
+			_commitDropped++;
+			return rdlib::Success;
+		}
+		if (_commitResend)
+		{
+			_pageBuffer.resendAll();
+			_commitResend = false;
+		}
+		if (_commitQueued)
+			_commitDropped++; // replaced before it was sent, its columns are merged
+		takeDirtyPages(_dirtyQueued, _commitQueued);
+		std::span<const uint8_t> buffer = _pageBuffer.data();
+		_frameQueued.assign(buffer.begin(), buffer.end());
+		_commitQueued = true;
+	}
+	_commitCond.notify_all();
+	return rdlib::Success;
+}
+
+/*!
+	@brief Wait until the committed frames are sent
+	@return result of the last transfer, rdlib::Success if none or not started
+*/
+rdlib::Return_Codes_e bicolor_graphics::waitCommit(void)
+{
+	std::unique_lock<std::mutex> lock(_commitMutex);
+	_commitCond.wait(lock, [this]() { return !_commitQueued && !_commitInFlight; });
+	return _commitResult;
+}
+
+/*!
+	@brief Is a committed frame waiting or being sent
+	@return true if busy
+*/
+bool bicolor_graphics::isCommitBusy(void)
+{
+	std::lock_guard<std::mutex> lock(_commitMutex);
+	return _commitQueued || _commitInFlight;
+}
+
+/*!
+	@brief Get the number of committed frames never sent, dropped or replaced while busy
+	@return dropped frame count since commitAsyncBegin
+*/
+uint32_t bicolor_graphics::getCommitDroppedCount(void)
+{
+	std::lock_guard<std::mutex> lock(_commitMutex);
+	return _commitDropped;
+}
+
+/*!
+	@brief Send the changed columns of the screen buffer and wait, used by the display's buffer update
+	@param buffer the screen buffer
+	@return result of sendFrame
+	@details Waits for a background transfer first, if it failed the whole buffer is sent.
+		If this transfer fails the whole buffer is sent by the next update.
+*/
+rdlib::Return_Codes_e bicolor_graphics::updateFrame(std::span<const uint8_t> buffer)
+{
+	waitCommit();
+	{
+		std::lock_guard<std::mutex> lock(_commitMutex);
+		if (_commitResend)
+		{
+			_pageBuffer.resendAll();
+			_commitResend = false;
+		}
+	}
+	takeDirtyPages(_dirtyUpdate, false);
+	rdlib::Return_Codes_e result = sendFrame(buffer, _dirtyUpdate);
+	if (result != rdlib::Success)
+		_pageBuffer.resendAll();
+	return result;
+}
+
+/*!
+	@brief Send columns of a frame to the display, implemented by each display
+	@param frame screen buffer or a committed copy of it
+	@param dirty column range to send of each page, first > last to skip the page
+	@return rdlib::GenericError here, the display has no buffer update
+	@note Runs on the commit thread for commitAsync, so it must only use frame and
+		the bus, not the screen buffer or _pageBuffer.
+*/
+rdlib::Return_Codes_e bicolor_graphics::sendFrame(std::span<const uint8_t> frame,
+		std::span<const page_buffer_1bpp::DirtyRange_t> dirty)
+{
+	(void)frame;
+	(void)dirty;
+	fprintf(stderr, "Error: sendFrame: Display has no buffer update\n");
+	return rdlib::GenericError;
+}
+
+/// @cond
+
+// Fills a rectangle straight into the page buffer.
+// Returns false if there is no page buffer, caller falls back to drawing pixels.
+bool bicolor_graphics::pageFillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint8_t color)
+{
+	if (!_pageBuffer.isAttached())
+		return false;
+	_pageBuffer.fillRect(x, y, w, h, color);
+	return true;
+}
+
+// Blits a bitmap in drawBitmapAddr addressing into the page buffer.
+// Horizontal bitmaps are transposed to column-major first.
+// Returns false if there is no page buffer.
+bool bicolor_graphics::pageBlit(int16_t x, int16_t y, std::span<const uint8_t> bitmap, int16_t w, int16_t h, page_buffer_1bpp::RasterOp_e op)
+{
+	if (!_pageBuffer.isAttached())
+		return false;
+	if (_drawBitmapAddr)
+		return _pageBuffer.blit(x, y, bitmap, w, h, op);
+
+	const int16_t byteWidth = (w + 7) / 8;
+	_blitColumns.assign(static_cast<size_t>(w) * ((h + 7) / 8), 0);
+	for (int16_t j = 0; j < h; j++)
+	{
+		uint8_t* column = _blitColumns.data() + ((j / 8) * w);
+		const uint8_t rowBit = static_cast<uint8_t>(1 << (j & 7));
+		for (int16_t i = 0; i < w; i++)
+		{
+			if (bitmap[(j * byteWidth) + (i / 8)] & (0x80 >> (i & 7)))
+				column[i] |= rowBit;
+		}
+	}
+	return _pageBuffer.blit(x, y, _blitColumns, w, h, op);
+}
+
+// Takes the dirty column range of every page, clamped to the screen width.
+// merge: widen the ranges already in dirty, for a frame replaced before it was sent.
+void bicolor_graphics::takeDirtyPages(std::vector<page_buffer_1bpp::DirtyRange_t>& dirty, bool merge)
+{
+	const uint8_t pages = static_cast<uint8_t>((HEIGHT + 7) / 8);
+	if (dirty.size() != pages)
+	{
+		dirty.assign(pages, {WIDTH, -1});
+		merge = false;
+	}
+	for (uint8_t page = 0; page < pages; page++)
+	{
+		page_buffer_1bpp::DirtyRange_t range = _pageBuffer.takeDirty(page);
+		range.last = std::min<int16_t>(range.last, WIDTH - 1);
+		if (merge && dirty[page].first <= dirty[page].last)
+		{
+			range.first = std::min(range.first, dirty[page].first);
+			range.last = std::max(range.last, dirty[page].last);
+		}
+		dirty[page] = range;
+	}
+}
+
+// Commit thread, sends each queued frame until stopped
+void bicolor_graphics::commitThread(void)
+{
+	std::unique_lock<std::mutex> lock(_commitMutex);
+	for (;;)
+	{
+		_commitCond.wait(lock, [this]() { return _commitStop || _commitQueued; });
+		if (!_commitQueued) return;
+		_frameInFlight.swap(_frameQueued);
+		_dirtyInFlight.swap(_dirtyQueued);
+		_commitQueued = false;
+		_commitInFlight = true;
+		lock.unlock();
+		rdlib::Return_Codes_e result = sendFrame(_frameInFlight, _dirtyInFlight);
+		lock.lock();
+		_commitInFlight = false;
+		_commitResult = result;
+		if (result != rdlib::Success)
+		{
+			// the queued frame is a whole copy of the buffer, send all of it in place of its own columns,
+			// else the drawing thread marks the buffer for resend, it owns the dirty state
+			if (_commitQueued)
+				std::fill(_dirtyQueued.begin(), _dirtyQueued.end(), page_buffer_1bpp::DirtyRange_t{0, static_cast<int16_t>(WIDTH - 1)});
+			else
+				_commitResend = true;
+		}
+		_commitCond.notify_all();
+	}
+}
+
+// drawBitmap fast path for BLACK on WHITE or WHITE on BLACK.
+// Returns false for other colours or no page buffer, caller draws per pixel.
+bool bicolor_graphics::opaqueBitmapBlit(int16_t x, int16_t y, std::span<const uint8_t> bitmap, int16_t w, int16_t h, uint8_t color, uint8_t bg)
+{
+	if (color == BLACK && bg == WHITE)
+		return pageBlit(x, y, bitmap, w, h, page_buffer_1bpp::RasterOp_e::Copy);
+	if (color == WHITE && bg == BLACK)
+		return pageBlit(x, y, bitmap, w, h, page_buffer_1bpp::RasterOp_e::NotSrc);
+	return false;
+}
+
+/// @endcond
+
 /*!
 	@brief Fills the whole screen with a given color.
 	@param  color color to fill screen
@@ -635,6 +984,7 @@ bicolor_graphics::displayBC_rotate_e  bicolor_graphics::getRotation(void){return
 void bicolor_graphics::setRotation(displayBC_rotate_e  CurrentRotation) {
 
 	_display_rotate = CurrentRotation;
+	_pageBuffer.setRotation(CurrentRotation);
 	switch(CurrentRotation)
 	{
 		case BC_Degrees_0:
@@ -668,6 +1018,7 @@ void bicolor_graphics::setRotation(displayBC_rotate_e  CurrentRotation) {
 		-# Bitmap excepted size = 128 * (64/8) = 1024 bytes.
 		-# A horizontal Bitmap's w must be divisible by 8. For a bitmap with w=88 & h=48.
 		-# Bitmap excepted size = (88/8) * 48 = 528 bytes.
+		-# BLACK on WHITE or WHITE on BLACK is drawn with bitBlt when there is a page buffer.
 */
 rdlib::Return_Codes_e bicolor_graphics::drawBitmap(int16_t x, int16_t y,
 				const std::span<const uint8_t> bitmap, int16_t w, int16_t h,
@@ -704,6 +1055,8 @@ if (_drawBitmapAddr== true)
 		fprintf(stderr, "Error drawBitmap 4A-2 : Vertical Bitmap size is incorrect: (w * (h / 8)\n");
 		return rdlib::BitmapSize;
 	}
+	if (opaqueBitmapBlit(x, y, bitmap, w, h, color, bg))
+		return rdlib::Success;
 	// Vertical byte bitmaps mode
 	uint8_t vline;
 	int16_t i, j, r = 0, yin = y;
@@ -720,10 +1073,10 @@ if (_drawBitmapAddr== true)
 		for (j=0; j<8; j++ ) {
 			if (y+j-yin == h) break;
 			if (vline & 0x1) {
-				drawPixel(x+i, y+j, color);
+				plotPixel(x+i, y+j, color);
 			}
 			else {
-				drawPixel(x+i, y+j, bg);
+				plotPixel(x+i, y+j, bg);
 			}
 			vline >>= 1;
 		}
@@ -739,6 +1092,8 @@ if (_drawBitmapAddr== true)
 		fprintf(stderr, "Error drawBitmap 4B-2: Horizontal Bitmap size is incorrect:  Check Size =  (w/8 * h)\n");
 		return rdlib::BitmapSize;
 	}
+	if (opaqueBitmapBlit(x, y, bitmap, w, h, color, bg))
+		return rdlib::Success;
 
 	// Horizontal byte bitmaps mode
 	int16_t byteWidth = (w + 7) / 8;
@@ -751,13 +1106,54 @@ if (_drawBitmapAddr== true)
 				byte <<= 1;
 			else
 				byte = bitmap[j * byteWidth + i / 8];
-			drawPixel(x+i, y, (byte & 0x80) ? color : bg);
+			plotPixel(x+i, y, (byte & 0x80) ? color : bg);
 		}
 	}
 } // end of elseif
 return rdlib::Success;
 } // end of function
 
+/*!
+	@brief Combine a 1-bit bitmap into the screen buffer with a raster operation
+	@param x x co-ord position, may be partly off screen
+	@param y y co-ord position, may be partly off screen, need not be a multiple of 8
+	@param bitmap span to bitmap data, set bits are BLACK pixels
+	@param w width of the bitmap
+	@param h height of the bitmap
+	@param op raster operation Copy, Or, And, Xor or NotSrc
+	@return Will return rdlib::Return_Codes_e enum
+		-# rdlib::Success
+		-# rdlib::BitmapDataEmpty bitmap is empty
+		-# rdlib::BitmapSize bitmap size is not w * ((h+7)/8) vertical or ((w+7)/8) * h horizontal
+		-# rdlib::BufferEmpty display has no page buffer
+	@details Variable drawBitmapAddr controls data addressing as for drawBitmap,
+		but w and h need not be multiples of 8. The bitmap is clipped to the screen.
+		At rotation 0 a byte column is combined at a time, so sprites, cursors
+		and Xor highlights are cheap to draw every frame.
+*/
+rdlib::Return_Codes_e bicolor_graphics::bitBlt(int16_t x, int16_t y, const std::span<const uint8_t> bitmap,
+		int16_t w, int16_t h, page_buffer_1bpp::RasterOp_e op)
+{
+	if (bitmap.empty())
+	{
+		fprintf(stderr, "Error 1 : bitBlt : Bitmap is not valid object\n");
+		return rdlib::BitmapDataEmpty;
+	}
+	size_t expectedSize = _drawBitmapAddr ?
+		static_cast<size_t>(w) * ((h + 7) / 8) : static_cast<size_t>((w + 7) / 8) * h;
+	if (w <= 0 || h <= 0 || bitmap.size() != expectedSize)
+	{
+		fprintf(stderr, "Error 2 : bitBlt : Bitmap size is incorrect\n");
+		return rdlib::BitmapSize;
+	}
+	if (!pageBlit(x, y, bitmap, w, h, op))
+	{
+		fprintf(stderr, "Error 3 : bitBlt : Display has no page buffer\n");
+		return rdlib::BufferEmpty;
+	}
+	return rdlib::Success;
+}
+
 
 /*!
 	@brief sets the data addressing mode in drawBitmap function.
@@ -927,7 +1323,7 @@ rdlib::Return_Codes_e bicolor_graphics::drawDotGrid(int16_t x, int16_t y, int16_
 	{
 		for (int16_t col = x; col <= w; col += DotGridGap) 
 		{
-			drawPixel(col, row, color);
+			plotPixel(col, row, color);
 		}
 	}
 	return rdlib::Success;
@@ -951,7 +1347,7 @@ void bicolor_graphics::drawLineAngle(int16_t x, int16_t y, int angle, uint8_t st
 {
 	if (start == 0){
 		if (length < 2) {
-			drawPixel(x, y, color);
+			plotPixel(x, y, color);
 		} else {
 				drawLine(x, y, 
 				x + length * rdlib_maths::cosineFromDegrees(angle + offset), 
@@ -959,7 +1355,7 @@ void bicolor_graphics::drawLineAngle(int16_t x, int16_t y, int angle, uint8_t st
 		}
 	} else{
 		if (start - length < 2) {
-			drawPixel(x,y,color);
+			plotPixel(x,y,color);
 		} else {
 			drawLine(
 			x + start * rdlib_maths::cosineFromDegrees(angle + offset),
@@ -1118,10 +1514,10 @@ void bicolor_graphics::drawEllipse(int16_t cx, int16_t cy, int16_t semiMajorAxis
  */
 void bicolor_graphics::ellipseHelper(uint16_t cx, uint16_t cy, uint16_t x, uint16_t y, uint8_t color)
 {
-	drawPixel(cx + x, cy + y, color);
-	if (x != 0) drawPixel(cx - x, cy + y, color);
-	if (y != 0) drawPixel(cx + x, cy - y, color);
-	if (x != 0 && y != 0) drawPixel(cx - x, cy - y, color);
+	plotPixel(cx + x, cy + y, color);
+	if (x != 0) plotPixel(cx - x, cy + y, color);
+	if (y != 0) plotPixel(cx + x, cy - y, color);
+	if (x != 0 && y != 0) plotPixel(cx - x, cy - y, color);
 }
 
 /*!
@@ -1348,6 +1744,6 @@ void bicolor_graphics::drawSimpleArc(int16_t cx, int16_t cy, int16_t radius, flo
 		float rad = angle * degreesToRadians;
 		int16_t x = cx + radius * cos(rad);
 		int16_t y = cy + radius * sin(rad);
-		drawPixel(x, y, color);
+		plotPixel(x, y, color);
 	}
 }
@@ -0,0 +1,312 @@
+/*!
+	@file     bitbang_bus_RDL.cpp
+	@author   Gavin Lyons
+	@brief    Source file for the bit banged (software) serial bus of the LED segment drivers.
+*/
+
+#include "../include/bitbang_bus_RDL.hpp"
+
+// Section : bitbang_delay
+
+/*!
+	@brief Delay for a bit banged bus
+	@param microSec delay in uS, 0 returns at once
+	@details Up to SpinLimitMicroSec busy-waits, above that sleeps.
+*/
+void bitbang_delay::delayMicroSec(uint32_t microSec)
+{
+	if (microSec == 0) return;
+	if (microSec > SpinLimitMicroSec)
+	{
+		delayMicroSecRDL(microSec);
+		return;
+	}
+	spin(static_cast<uint64_t>(loopsPerMicroSec()) * microSec);
+}
+
+/*!
+	@brief Get the busy-wait loop count for one microsecond
+	@return loops per uS, measured the first time this is called
+	@note The first call takes a few milliseconds, drivers call it in their begin function.
+*/
+uint32_t bitbang_delay::loopsPerMicroSec(void)
+{
+	static const uint32_t loops = calibrate();
+	return loops;
+}
+
+/// @cond
+
+// Busy-wait loop, the volatile counter keeps it from being optimised away
+void bitbang_delay::spin(uint64_t loops)
+{
+	volatile uint64_t count = 0;
+	while (count < loops)
+	{
+		count = count + 1;
+	}
+}
+
+// Time the busy-wait loop against the steady clock.
+// The fastest of several runs is kept so a delay is never shorter than asked,
+// a run slowed by the scheduler or a low CPU clock only makes delays longer.
+uint32_t bitbang_delay::calibrate(void)
+{
+	using clock_t = std::chrono::steady_clock;
+	constexpr double RunMicroSec = 2000.0;
+	constexpr uint8_t Runs = 5;
+
+	// warm up, lets the CPU frequency governor raise the clock
+	const auto warmUpEnd = clock_t::now() + std::chrono::milliseconds(10);
+	while (clock_t::now() < warmUpEnd) {}
+
+	uint64_t loops = 1024;
+	double elapsed = 0.0;
+	for (uint8_t grow = 0; grow < 32 && elapsed < RunMicroSec; grow++)
+	{
+		loops *= 2;
+		const auto start = clock_t::now();
+		spin(loops);
+		elapsed = std::chrono::duration<double, std::micro>(clock_t::now() - start).count();
+	}
+	double bestRate = (elapsed > 0.0) ? loops / elapsed : 1.0;
+	for (uint8_t run = 0; run < Runs; run++)
+	{
+		const auto start = clock_t::now();
+		spin(loops);
+		elapsed = std::chrono::duration<double, std::micro>(clock_t::now() - start).count();
+		if (elapsed > 0.0 && loops / elapsed > bestRate) bestRate = loops / elapsed;
+	}
+	uint32_t result = static_cast<uint32_t>(bestRate) + 1;
+	return result;
+}
+
+/// @endcond
+
+// Section : bitbang_bus
+
+/*!
+	@brief Claim the clock and data lines as outputs
+	@param gpioHandle handle to the gpiochip, from lgGpiochipOpen
+	@param clock GPIO of the clock line
+	@param data GPIO of the data line
+	@param lFlags lgpio line flags e.g. LG_SET_OPEN_DRAIN, 0 for push pull
+	@param idleLevel level both lines are set to
+	@return lgpio status, negative on error
+	@details Also runs the busy-wait calibration of bitbang_delay if not done yet.
+*/
+int bitbang_bus::claim(int gpioHandle, uint8_t clock, uint8_t data, int lFlags, bool idleLevel)
+{
+	_GpioHandle = gpioHandle;
+	_Display_SCLK = clock;
+	_Display_SDATA = data;
+	_lFlags = lFlags;
+	_levels = idleLevel ? (ClockBit | DataBit) : 0;
+	_dataInput = false;
+
+	const int gpios[2] = {_Display_SCLK, _Display_SDATA};
+	const int levels[2] = {idleLevel, idleLevel};
+	int status = Display_GROUP_CLAIM_OUTPUT(_GpioHandle, _lFlags, 2, gpios, levels);
+	_grouped = (status >= 0);
+	if (!_grouped)
+	{
+		status = Display_GPIO_CLAIM_OUTPUT(_GpioHandle, _lFlags, _Display_SCLK, idleLevel);
+		if (status >= 0)
+			status = Display_GPIO_CLAIM_OUTPUT(_GpioHandle, _lFlags, _Display_SDATA, idleLevel);
+	}
+	_claimed = (status >= 0);
+	bitbang_delay::loopsPerMicroSec();
+	return status;
+}
+
+/*!
+	@brief Free the clock and data lines
+	@return lgpio status, negative on error
+*/
+int bitbang_bus::release(void)
+{
+	if (!_claimed) return 0;
+	int status = 0;
+	if (_grouped && !_dataInput)
+	{
+		status = Display_GROUP_FREE(_GpioHandle, _Display_SCLK);
+	} else
+	{
+		status = Display_GPIO_FREE_CLK;
+		int dataStatus = Display_GPIO_FREE_SDATA;
+		if (status >= 0) status = dataStatus;
+	}
+	_claimed = false;
+	_dataInput = false;
+	return status;
+}
+
+/*!
+	@brief Switch the data line to input, to read from the chip
+	@return lgpio status, negative on error
+	@note The clock stays an output at its current level.
+*/
+int bitbang_bus::setDataInput(void)
+{
+	if (_dataInput) return 0;
+	int status = 0;
+	if (_grouped)
+	{
+		status = Display_GROUP_FREE(_GpioHandle, _Display_SCLK);
+		if (status >= 0)
+			status = Display_GPIO_CLAIM_OUTPUT(_GpioHandle, _lFlags, _Display_SCLK, (_levels & ClockBit) ? 1 : 0);
+	}
+	if (status >= 0)
+		status = Display_GPIO_CLAIM_INPUT(_GpioHandle, 0, _Display_SDATA);
+	if (status >= 0) _dataInput = true;
+	return status;
+}
+
+/*!
+	@brief Switch the data line back to output, set low
+	@return lgpio status, negative on error
+*/
+int bitbang_bus::setDataOutput(void)
+{
+	if (!_dataInput) return 0;
+	_levels &= ~DataBit;
+	int status = 0;
+	if (_grouped)
+	{
+		Display_GPIO_FREE_CLK;
+		Display_GPIO_FREE_SDATA;
+		const int gpios[2] = {_Display_SCLK, _Display_SDATA};
+		const int levels[2] = {(_levels & ClockBit) ? 1 : 0, 0};
+		status = Display_GROUP_CLAIM_OUTPUT(_GpioHandle, _lFlags, 2, gpios, levels);
+		if (status < 0)
+		{ // fall back to single lines
+			_grouped = false;
+			status = Display_GPIO_CLAIM_OUTPUT(_GpioHandle, _lFlags, _Display_SCLK, levels[0]);
+			if (status >= 0)
+				status = Display_GPIO_CLAIM_OUTPUT(_GpioHandle, _lFlags, _Display_SDATA, 0);
+		}
+	} else
+	{
+		status = Display_GPIO_CLAIM_OUTPUT(_GpioHandle, _lFlags, _Display_SDATA, 0);
+	}
+	if (status >= 0) _dataInput = false;
+	return status;
+}
+
+/*!
+	@brief Set both lines, in one write if grouped
+	@param clock clock level
+	@param data data level, ignored while the data line is an input
+*/
+void bitbang_bus::setLines(bool clock, bool data)
+{
+	write((clock ? ClockBit : 0) | (data ? DataBit : 0), ClockBit | DataBit);
+}
+
+/*!
+	@brief Set the clock line
+	@param level clock level
+*/
+void bitbang_bus::setClock(bool level)
+{
+	write(level ? ClockBit : 0, ClockBit);
+}
+
+/*!
+	@brief Set the data line
+	@param level data level, ignored while the data line is an input
+*/
+void bitbang_bus::setData(bool level)
+{
+	write(level ? DataBit : 0, DataBit);
+}
+
+/*!
+	@brief Read the level of the data line
+	@return true if the line is high
+	@details Works with the data line as an input, or as an open drain output that is released.
+*/
+bool bitbang_bus::readData(void)
+{
+	if (_grouped && !_dataInput)
+	{
+		uint64_t levels = 0;
+		if (Display_GROUP_READ(_GpioHandle, _Display_SCLK, &levels) < 0) return false;
+		return (levels & DataBit) != 0;
+	}
+	return Display_SDATA_Read > 0;
+}
+
+/*!
+	@brief Shift a byte out, data sampled by the chip on the rising clock edge
+	@param value the byte to send
+	@param order bit order
+	@param delayMicroSec delay after each clock edge, uS
+	@details Clock is left low. Each falling clock edge and the next data bit are one write.
+*/
+void bitbang_bus::shiftOut(uint8_t value, BitOrder_e order, uint32_t delayMicroSec)
+{
+	write(bitOf(value, 0, order) ? DataBit : 0, ClockBit | DataBit);
+	for (uint8_t bit = 0; bit < 8; bit++)
+	{
+		write(ClockBit, ClockBit);
+		bitbang_delay::delayMicroSec(delayMicroSec);
+		if (bit < 7)
+			write(bitOf(value, bit + 1, order) ? DataBit : 0, ClockBit | DataBit);
+		else
+			write(0, ClockBit);
+		bitbang_delay::delayMicroSec(delayMicroSec);
+	}
+}
+
+/*!
+	@brief Shift a byte in, data read before each rising clock edge
+	@param order bit order
+	@param delayMicroSec delay after each clock edge, uS
+	@return the byte read
+	@note Call setDataInput first.
+*/
+uint8_t bitbang_bus::shiftIn(BitOrder_e order, uint32_t delayMicroSec)
+{
+	uint8_t value = 0;
+	for (uint8_t bit = 0; bit < 8; bit++)
+	{
+		if (readData())
+			value |= (order == BitOrder_e::LSBFirst) ? (1 << bit) : (0x80 >> bit);
+		write(ClockBit, ClockBit);
+		bitbang_delay::delayMicroSec(delayMicroSec);
+		write(0, ClockBit);
+		bitbang_delay::delayMicroSec(delayMicroSec);
+	}
+	return value;
+}
+
+/// @cond
+
+// Write the lines in mask that change, one group write or clock then data
+void bitbang_bus::write(uint8_t levels, uint8_t mask)
+{
+	if (_dataInput) mask &= ~DataBit;
+	uint8_t changed = (_levels ^ levels) & mask;
+	if (changed == 0) return;
+	_levels ^= changed;
+	if (_grouped && !_dataInput)
+	{
+		Display_GROUP_WRITE(_GpioHandle, _Display_SCLK, _levels, changed);
+		return;
+	}
+	if (changed & ClockBit)
+		(_levels & ClockBit) ? Display_SCLK_SetHigh : Display_SCLK_SetLow;
+	if (changed & DataBit)
+		(_levels & DataBit) ? Display_SDATA_SetHigh : Display_SDATA_SetLow;
+}
+
+// Bit index of a byte in shift order
+bool bitbang_bus::bitOf(uint8_t value, uint8_t index, BitOrder_e order)
+{
+	return (order == BitOrder_e::LSBFirst) ? ((value >> index) & 0x01) : ((value >> (7 - index)) & 0x01);
+}
+
+/// @endcond
+
+// **************** EOF *****************
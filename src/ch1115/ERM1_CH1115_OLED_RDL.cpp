@@ -202,6 +202,7 @@ rdlib::Return_Codes_e ERMCH1115::OLEDSetBufferPtr(uint8_t width, uint8_t height
 		return rdlib::BufferEmpty;
 	}
 	_OLEDbuffer = buffer;
+	setPageBuffer(_OLEDbuffer, _OLED_WIDTH);
 	return rdlib::Success;
 }
 
@@ -217,6 +218,7 @@ rdlib::Return_Codes_e ERMCH1115::OLEDSetBufferPtr(uint8_t width, uint8_t height
 */
 rdlib::Return_Codes_e  ERMCH1115::OLEDSPIoff(void)
 {
+	commitAsyncEnd();
 	uint8_t ErrorFlag = 0; // Becomes > 0 in event of error
 	
 	// 1. Free Reset & DC GPIO lines
@@ -295,6 +297,7 @@ rdlib::Return_Codes_e  ERMCH1115::OLEDSPIoff(void)
 */
 void ERMCH1115::OLEDPowerDown(void)
 {
+	commitAsyncEnd();
 	OLEDEnable(0);
 	Display_DC_SetLow;
 	Display_RST_SetLow;
@@ -387,6 +390,7 @@ void ERMCH1115::OLEDinit()
 
 	send_command(ERMCH1115_DISPLAY_ON, 0);
 	_sleep= false;
+	_pageBuffer.resendAll();
 
 	if (GetCommMode() == 3)
 		Display_CS_SetHigh ;
@@ -402,6 +406,7 @@ void ERMCH1115::OLEDinit()
 */
 void ERMCH1115::send_command (uint8_t command,uint8_t value)
 {
+	auto busLock = SPIBusLock();
 	Display_DC_SetLow;
 	send_data(command | value);
 	Display_DC_SetHigh;
@@ -572,15 +577,18 @@ void ERMCH1115::OLEDFillScreen(uint8_t dataPattern)
 	 @brief Fill the chosen page(0-7)  with a datapattern
 	 @param pageNum  page 0-7 divides 64 pixel screen into 8 pages or blocks  64/8
 	 @param dataPattern can be set to 0 to FF (not buffer)
+	 @note The page is sent in full by the next OLEDupdate.
 */
 void ERMCH1115::OLEDFillPage(uint8_t pageNum, uint8_t dataPattern)
 {
+	auto busLock = SPIBusLock();
 
 	if (pageNum >= 8)
 	{
 		fprintf(stderr, "Error: OLEDFillPage  :page number must be between 0 and 7 \n");
 		return;
 	}
+	_pageBuffer.resendPage(pageNum);
 	if (GetCommMode() == 3)
 		Display_CS_SetLow;
 
@@ -597,10 +605,9 @@ void ERMCH1115::OLEDFillPage(uint8_t pageNum, uint8_t dataPattern)
 	if (GetCommMode() == 3)
 		Display_CS_SetLow;
 
-	for (uint8_t i = 0; i < _OLED_WIDTH; i++)
-	{
-		send_data(dataPattern);
-	}
+	uint8_t pageData[256];
+	std::fill_n(pageData, _OLED_WIDTH, dataPattern);
+	send_data(std::span<const uint8_t>(pageData, _OLED_WIDTH));
 	if (GetCommMode() == 3)
 		Display_CS_SetHigh ;
 }
@@ -613,9 +620,12 @@ void ERMCH1115::OLEDFillPage(uint8_t pageNum, uint8_t dataPattern)
 	 @param h height 0-64
 	 @param data span to the bitmap data
 	 @note data is const. writes direct to screen , no buffer.
+		The screen buffer is sent in full by the next OLEDupdate.
 */
 void ERMCH1115::OLEDBitmap(int16_t x, int16_t y, uint8_t w, uint8_t h, const std::span<const uint8_t> data)
 {
+	auto busLock = SPIBusLock();
+	_pageBuffer.resendAll();
 	if (GetCommMode() == 3)
 		Display_CS_SetLow;
 
@@ -623,6 +633,8 @@ void ERMCH1115::OLEDBitmap(int16_t x, int16_t y, uint8_t w, uint8_t h, const std
 	uint16_t offset = 0;
 	uint8_t column = (x < 0) ? 0 : x;
 	uint8_t page = (y < 0) ? 0 : y >>3;
+	uint8_t rowData[256];
+	uint16_t count = 0;
 
 	for (ty = 0; ty < h; ty = ty + 8)
 	{
@@ -631,12 +643,14 @@ void ERMCH1115::OLEDBitmap(int16_t x, int16_t y, uint8_t w, uint8_t h, const std
 		send_command(ERMCH1115_SET_COLADD_MSB, (column & 0xF0) >> 4);
 		send_command(ERMCH1115_SET_PAGEADD, page++);
 
+		count = 0;
 		for (tx = 0; tx < w; tx++)
 		{
 				if (x + tx < 0 || x + tx >= _OLED_WIDTH) {continue;}
 				offset = (w * (ty >> 3)) + tx;
-				send_data(data[offset]);
+				rowData[count++] = data[offset];
 		}
+		send_data(std::span<const uint8_t>(rowData, count));
 	}
 	if (GetCommMode() == 3)
 		Display_CS_SetHigh ;
@@ -648,6 +662,7 @@ void ERMCH1115::OLEDBitmap(int16_t x, int16_t y, uint8_t w, uint8_t h, const std
 */
 void ERMCH1115::send_data(uint8_t dataByte)
 {
+	auto busLock = SPIBusLock();
 	int spiErrorStatus = 0;
 	char TransmitBuffer[1];
 	TransmitBuffer[0] = dataByte;
@@ -664,12 +679,38 @@ void ERMCH1115::send_data(uint8_t dataByte)
 	}
 }
 
+/*!
+	 @brief Send data bytes with SPI to ERMCH1115
+	 @param data the data bytes to send
+	 @details Hardware SPI sends them in one transfer, not one per byte.
+*/
+void ERMCH1115::send_data(std::span<const uint8_t> data)
+{
+	auto busLock = SPIBusLock();
+	int spiErrorStatus = 0;
+	switch (GetCommMode())
+	{
+		case 2:
+			if (data.empty()) break;
+			spiErrorStatus = Display_SPI_WRITE(_spiHandle, reinterpret_cast<const char*>(data.data()), data.size());
+			if (spiErrorStatus <0) 
+			{
+				fprintf(stderr, "Error : Failure to Write  SPI :(%s)\n", lguErrorText(spiErrorStatus));
+			}
+		break;
+		case 3: for (uint8_t dataByte : data) SoftwareSPIShiftOut(dataByte); break;
+	}
+}
+
 
 /*!
 	@brief updates the OLED i.e. writes  buffer to the screen
 	@return 
 		-# Success 
 		-# BufferEmpty if buffer is empty object
+	@details Only the columns changed since the last update are sent, each changed
+		page gets its column and page address commands then its changed bytes.
+		Unchanged pages are skipped. Blocks until sent, see commitAsync to send in the background.
 */
 rdlib::Return_Codes_e ERMCH1115::OLEDupdate()
 {
@@ -678,11 +719,35 @@ rdlib::Return_Codes_e ERMCH1115::OLEDupdate()
 		fprintf(stderr, "Error: OLEDupdate: Buffer is empty, cannot update screen\r\n");
 		return rdlib::BufferEmpty;
 	}
-	uint8_t x = 0; 
-	uint8_t y = 0; 
-	uint8_t w = this->_OLED_WIDTH; 
-	uint8_t h = this->_OLED_HEIGHT;
-	OLEDBufferScreen( x,  y,  w,  h, this->_OLEDbuffer);
+	updateFrame(_OLEDbuffer);
+	return rdlib::Success;
+}
+
+/*!
+	@brief Sends the changed columns of a frame, used by OLEDupdate and commitAsync
+	@param frame screen buffer or a committed copy of it
+	@param dirty column range to send of each page
+	@return rdlib::Success
+*/
+rdlib::Return_Codes_e ERMCH1115::sendFrame(std::span<const uint8_t> frame,
+		std::span<const page_buffer_1bpp::DirtyRange_t> dirty)
+{
+	auto busLock = SPIBusLock();
+	if (GetCommMode() == 3)
+		Display_CS_SetLow;
+
+	const uint8_t pages = std::min<size_t>(_OLED_PAGE_NUM, dirty.size());
+	for (uint8_t page = 0; page < pages; page++)
+	{
+		if (dirty[page].first > dirty[page].last) continue;
+		send_command(ERMCH1115_SET_COLADD_LSB, (dirty[page].first & 0x0F));
+		send_command(ERMCH1115_SET_COLADD_MSB, (dirty[page].first & 0xF0) >> 4);
+		send_command(ERMCH1115_SET_PAGEADD, page);
+		send_data(frame.subspan((page * _OLED_WIDTH) + dirty[page].first, dirty[page].last - dirty[page].first + 1));
+	}
+
+	if (GetCommMode() == 3)
+		Display_CS_SetHigh ;
 	return rdlib::Success;
 }
 
@@ -701,6 +766,7 @@ rdlib::Return_Codes_e ERMCH1115::OLEDclearBuffer()
 	}
 
 	std::fill(_OLEDbuffer.begin(), _OLEDbuffer.end(), 0x00);
+	_pageBuffer.markAllDirty();
 	return rdlib::Success;
 }
 
@@ -711,10 +777,12 @@ rdlib::Return_Codes_e ERMCH1115::OLEDclearBuffer()
 	 @param w width
 	 @param h height
 	 @param data span the bitmap data array
-	 @note Called by OLEDupdate, used internally mostly
+	 @note The screen buffer is sent in full by the next OLEDupdate.
 */
 void ERMCH1115::OLEDBufferScreen(int16_t x, int16_t y, uint8_t w, uint8_t h, std::span<uint8_t> data)
 {
+	auto busLock = SPIBusLock();
+	_pageBuffer.resendAll();
 
 	if (GetCommMode() == 3)
 		Display_CS_SetLow;
@@ -723,6 +791,8 @@ void ERMCH1115::OLEDBufferScreen(int16_t x, int16_t y, uint8_t w, uint8_t h, std
 	uint16_t offset = 0;
 	uint8_t column = (x < 0) ? 0 : x;
 	uint8_t page = (y < 0) ? 0 : y/8;
+	uint8_t rowData[256];
+	uint16_t count = 0;
 
 	for (ty = 0; ty < h; ty = ty + 8)
 	{
@@ -732,58 +802,20 @@ void ERMCH1115::OLEDBufferScreen(int16_t x, int16_t y, uint8_t w, uint8_t h, std
 	send_command(ERMCH1115_SET_COLADD_MSB, (column & 0XF0) >> 4);
 	send_command(ERMCH1115_SET_PAGEADD, page++);
 
+	count = 0;
 	for (tx = 0; tx < w; tx++)
 	{
 			if (x + tx < 0 || x + tx >= _OLED_WIDTH) {continue;}
 			offset = (w * (ty /8)) + tx;
-			send_data(data[offset++]);
+			rowData[count++] = data[offset];
 	}
+	send_data(std::span<const uint8_t>(rowData, count));
 	}
 
 	if (GetCommMode() == 3)
 		Display_CS_SetHigh ;
 }
 
-/*!
-	@brief Draws a Pixel to the screen , overides the  graphics library
-	@param x x co-ord of pixel
-	@param y y co-ord of pixel
-	@param colour colour of  pixel
-	@note virtual function overides the  graphics library
-*/
-void ERMCH1115::drawPixel(int16_t x, int16_t y, uint8_t colour)
-{
-
-	if ((x < 0) || (x >= this->_width) || (y < 0) || (y >= this->_height)){return;}
-
-	int16_t temp;
-	uint8_t rotation = getRotation();
-	switch (rotation) {
-	case 1:
-		temp = x;
-		x = WIDTH - 1 - y;
-		y = temp;
-	break;
-	case 2:
-		x = WIDTH - 1 - x;
-		y = HEIGHT - 1 - y;
-	break;
-	case 3:
-		temp = x;
-		x = y;
-		y = HEIGHT - 1 - temp;
-	break;
-	}
-	uint16_t tc = (_OLED_WIDTH * (y /8)) + x;
-	switch (colour)
-	{
-		case WHITE:  this->_OLEDbuffer[tc] &= ~(1 << (y & 7)); break;
-		case BLACK:  this->_OLEDbuffer[tc] |= (1 << (y & 7)); break;
-		case INVERSE: this->_OLEDbuffer[tc] ^= (1 << (y & 7)); break;
-	}
-
-}
-
 /*!
 	@brief Freq delay used in SW SPI getter, uS delay used in SW SPI method
 	@return The  GPIO communications delay in uS
@@ -32,6 +32,7 @@ if (_AdvancedScreenBuffer == AdvancedScreenBuffer_e::On){
 	_screenBuffer[index] = (uint8_t)(color >> 8);     // High byte
 	_screenBuffer[index + 1] = (uint8_t)(color & 0xFF); // Low byte
 }else{
+	auto busLock = SPIBusLock();
 	setAddrWindow(x, y, x + 1, y + 1);
 	uint8_t TransmitBuffer[2] {(uint8_t)(color >> 8), (uint8_t)(color & 0xFF)};
 	spiWriteDataBuffer(TransmitBuffer, 2);
@@ -88,6 +89,7 @@ rdlib::Return_Codes_e color16_graphics::fillRectangle(uint16_t x, uint16_t y, ui
 
 
 	// Set window and write buffer
+	auto busLock = SPIBusLock();
 	setAddrWindow(x, y, x + w - 1, y + h - 1);
 	spiWriteDataBuffer(buffer.data(), buffer.size());
 
@@ -127,6 +129,7 @@ rdlib::Return_Codes_e color16_graphics::drawFastVLine(uint16_t x, uint16_t y, ui
 		uint8_t hi, lo;
 		hi = color >> 8;
 		lo = color;
+		auto busLock = SPIBusLock();
 		setAddrWindow(x, y, x, y + h - 1);
 		Display_DC_SetHigh;
 
@@ -166,6 +169,7 @@ rdlib::Return_Codes_e color16_graphics::drawFastHLine(uint16_t x, uint16_t y, ui
 		uint8_t hi, lo;
 		hi = color >> 8;
 		lo = color;
+		auto busLock = SPIBusLock();
 		setAddrWindow(x, y, x + w - 1, y);
 		Display_DC_SetHigh;
 		if (_hardwareSPI == false){Display_CS_SetLow;}
@@ -667,6 +671,7 @@ if (_AdvancedScreenBuffer == AdvancedScreenBuffer_e::Off){
 		}
 	}
 	// Set window and write buffer
+	auto busLock = SPIBusLock();
 	setAddrWindow(x, y, x + w - 1, y + h - 1);
 	spiWriteDataBuffer(buffer.data(), buffer.size());
 }else{
@@ -751,6 +756,7 @@ if (_AdvancedScreenBuffer == AdvancedScreenBuffer_e::Off){
 		}
 	}
 	// Set window and write buffer
+	auto busLock = SPIBusLock();
 	setAddrWindow(x, y, x + w - 1, y + h - 1);
 	spiWriteDataBuffer(buffer.data(), buffer.size());
 }else{
@@ -835,6 +841,7 @@ if (_AdvancedScreenBuffer == AdvancedScreenBuffer_e::Off){
 		}
 	}
 	// Set window and write buffer
+	auto busLock = SPIBusLock();
 	setAddrWindow(x, y, x + w - 1, y + h - 1);
 	spiWriteDataBuffer(buffer.data(), buffer.size());
 }else{
@@ -870,6 +877,7 @@ uint16_t color16_graphics::Color565(int16_t r, int16_t g, int16_t b) {
  * @param color
  */
 void color16_graphics::pushColor(uint16_t color) {
+	auto busLock = SPIBusLock();
 	uint8_t hi, lo;
 	hi = color >> 8;
 	lo = color;
@@ -885,6 +893,7 @@ void color16_graphics::pushColor(uint16_t color) {
 	@param spicmdbyte command byte to send
 */
 void color16_graphics::writeCommand(uint8_t spicmdbyte) {
+	auto busLock = SPIBusLock();
 	Display_DC_SetLow;
 	if (_hardwareSPI == false){Display_CS_SetLow;}
 	spiWrite(spicmdbyte);
@@ -896,6 +905,7 @@ void color16_graphics::writeCommand(uint8_t spicmdbyte) {
 	@param spidatabyte byte to send
 */
 void color16_graphics::writeData(uint8_t spidatabyte) {
+	auto busLock = SPIBusLock();
 	Display_DC_SetHigh;
 	if (_hardwareSPI == false){Display_CS_SetLow;}
 	spiWrite(spidatabyte);
@@ -916,6 +926,7 @@ void color16_graphics::writeData(uint8_t spidatabyte) {
 	Readme for display for more details.
 */
 rdlib::Return_Codes_e  color16_graphics::spiWriteDataBuffer(uint8_t* spidata, int len) {
+	auto busLock = SPIBusLock();
 	rdlib::Return_Codes_e returnCode = rdlib::Success;
 	Display_DC_SetHigh;
 	if (_hardwareSPI == false) 
@@ -995,6 +1006,7 @@ rdlib::Return_Codes_e color16_graphics::spiWrite(uint8_t spidata) {
 	@return SPI data byte read
 */
 uint8_t color16_graphics::spiRead(void) {
+	auto busLock = SPIBusLock();
 	uint8_t result=0;
 	if (_hardwareSPI == false)
 	{
@@ -1128,6 +1140,7 @@ rdlib::Return_Codes_e color16_graphics::writeChar(int16_t x, int16_t y, char val
 			}
 		}
 		// Set window and write buffer
+		auto busLock = SPIBusLock();
 		setAddrWindow(x, y, x + _Font_X_Size - 1, y +_Font_Y_Size - 1);;
 		spiWriteDataBuffer(buffer.data(), buffer.size());
 	}
@@ -1999,6 +2012,7 @@ rdlib::Return_Codes_e color16_graphics::writeBuffer(void)
 		fprintf(stderr, "Error: writeBuffer: Buffer is empty\n");
 		return rdlib::BufferEmpty;
 	}
+	auto busLock = SPIBusLock();
 	setAddrWindow(0, 0, _width -1, _height);
 	spiWriteDataBuffer(const_cast<uint8_t *>(_screenBuffer.data()),_screenBuffer.size());
 	return rdlib::Success;
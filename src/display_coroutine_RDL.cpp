@@ -0,0 +1,133 @@
+/*!
+	@file     display_coroutine_RDL.cpp
+	@author   Gavin Lyons
+	@brief    Source file for C++20 coroutine awaitables of display transfers.
+*/
+
+#include "../include/display_coroutine_RDL.hpp"
+
+namespace rdlib_async {
+
+/*!
+	@brief Constructor for class transfer_executor, starts the worker threads
+	@param workerCount number of worker threads, 1 if 0 passed.
+		One worker per SPI or I2C bus is usually enough, transfers on a bus are serial anyway.
+*/
+transfer_executor::transfer_executor(uint8_t workerCount)
+{
+	if (workerCount == 0) workerCount = 1;
+	for (uint8_t i = 0; i < workerCount; i++)
+		_workers.emplace_back(&transfer_executor::workerThread, this);
+}
+
+/*!
+	@brief Destructor for class transfer_executor, workers finish queued transfers then exit
+	@note Coroutines still waiting to be resumed are not resumed, call run() first.
+*/
+transfer_executor::~transfer_executor()
+{
+	{
+		std::lock_guard<std::mutex> lock(_jobMutex);
+		_stop = true;
+	}
+	_jobCond.notify_all();
+	for (std::thread& worker : _workers)
+	{
+		if (worker.joinable()) worker.join();
+	}
+}
+
+/*!
+	@brief Queue a transfer, called by transfer_awaitable::await_suspend
+	@param transfer function to run on a worker
+	@param handle coroutine to resume when the transfer completes
+	@param result where the transfer return code is stored before resume
+*/
+void transfer_executor::submit(TransferFunc_t transfer, std::coroutine_handle<> handle, rdlib::Return_Codes_e* result)
+{
+	{
+		std::lock_guard<std::mutex> lock(_doneMutex);
+		_outstanding++;
+	}
+	{
+		std::lock_guard<std::mutex> lock(_jobMutex);
+		_jobs.push_back({std::move(transfer), handle, result});
+	}
+	_jobCond.notify_one();
+}
+
+/*!
+	@brief Resume the coroutines whose transfers have completed, does not block
+	@return number of coroutines resumed
+	@details Call from the event loop, coroutines resume on the calling thread.
+*/
+size_t transfer_executor::poll(void)
+{
+	std::vector<std::coroutine_handle<>> ready;
+	{
+		std::lock_guard<std::mutex> lock(_doneMutex);
+		ready.swap(_done);
+		_outstanding -= ready.size();
+	}
+	for (std::coroutine_handle<> handle : ready)
+		handle.resume();
+	return ready.size();
+}
+
+/*!
+	@brief Run the event loop until no transfers are outstanding
+	@details Blocks while transfers run, resumes coroutines as they complete.
+		Transfers started by resumed coroutines are run too.
+*/
+void transfer_executor::run(void)
+{
+	for (;;)
+	{
+		{
+			std::unique_lock<std::mutex> lock(_doneMutex);
+			_doneCond.wait(lock, [this]() { return !_done.empty() || _outstanding == 0; });
+			if (_done.empty() && _outstanding == 0) return;
+		}
+		poll();
+	}
+}
+
+/*!
+	@brief Get the number of transfers submitted and not yet resumed
+	@return outstanding transfer count
+*/
+size_t transfer_executor::outstanding(void)
+{
+	std::lock_guard<std::mutex> lock(_doneMutex);
+	return _outstanding;
+}
+
+/// @cond
+
+// Worker thread, runs transfers and queues their coroutines for resume
+void transfer_executor::workerThread(void)
+{
+	for (;;)
+	{
+		Job_t job;
+		{
+			std::unique_lock<std::mutex> lock(_jobMutex);
+			_jobCond.wait(lock, [this]() { return _stop || !_jobs.empty(); });
+			if (_jobs.empty()) return;
+			job = std::move(_jobs.front());
+			_jobs.pop_front();
+		}
+		*job.result = job.transfer ? job.transfer() : rdlib::GenericError;
+		{
+			std::lock_guard<std::mutex> lock(_doneMutex);
+			_done.push_back(job.handle);
+		}
+		_doneCond.notify_all();
+	}
+}
+
+/// @endcond
+
+} // namespace rdlib_async
+
+// **************** EOF *****************
@@ -199,6 +199,7 @@ rdlib::Return_Codes_e ERM19264_UC1609::LCDbegin(uint8_t AddressSet ,uint8_t Vbia
 */
 rdlib::Return_Codes_e  ERM19264_UC1609::LCDSPIoff(void)
 {
+	commitAsyncEnd();
 	uint8_t ErrorFlag = 0; // Becomes >0 in event of error
 	// 1. Free reset & DC GPIO lines
 	int GpioResetErrorStatus = 0;
@@ -276,6 +277,7 @@ rdlib::Return_Codes_e  ERM19264_UC1609::LCDSPIoff(void)
 */
 void ERM19264_UC1609::LCDPowerDown(void)
 {
+	commitAsyncEnd();
 	LCDReset();
 	LCDEnable(0);
 	Display_DC_SetLow ;
@@ -314,6 +316,7 @@ void ERM19264_UC1609::LCDinit()
 	sendCommand(UC1609_DISPLAY_ON, 0x01); // turn on display
 	sendCommand(UC1609_LCD_CONTROL, UC1609_ROTATION_NORMAL); // rotate to normal
 	_sleep= false;
+	_pageBuffer.resendAll();
 
 	switch (GetCommMode())
 	{
@@ -331,6 +334,7 @@ void ERM19264_UC1609::LCDinit()
 */
 void ERM19264_UC1609::sendCommand (uint8_t command, uint8_t value)
 {
+	auto busLock = SPIBusLock();
 	Display_DC_SetLow;
 	sendData(command | value);
 	Display_DC_SetHigh;
@@ -434,6 +438,7 @@ rdlib::Return_Codes_e ERM19264_UC1609::LCDrotate(LCD_rotate_command_e rotatevalu
 		case 2:  break;
 		case 3: Display_CS_SetHigh; break;
 	}
+	_pageBuffer.resendAll();
 	return rdlib::Success;
 }
 
@@ -487,6 +492,8 @@ void ERM19264_UC1609::LCDallpixelsOn(uint8_t bits)
 */
 void ERM19264_UC1609::LCDFillPage(uint8_t page_num, uint8_t dataPattern)
 {
+	auto busLock = SPIBusLock();
+	_pageBuffer.resendPage(page_num);
 	switch (GetCommMode())
 	{
 		case 2: ; break;
@@ -509,10 +516,9 @@ void ERM19264_UC1609::LCDFillPage(uint8_t page_num, uint8_t dataPattern)
 		case 3: Display_CS_SetLow; break;
 	}
 
-	for (uint8_t i = 0; i < _LCD_WIDTH; i++)
-	{
-		sendData(dataPattern);
-	}
+	uint8_t pageData[256];
+	std::fill_n(pageData, _LCD_WIDTH, dataPattern);
+	sendData(std::span<const uint8_t>(pageData, _LCD_WIDTH));
 	switch (GetCommMode())
 	{
 		case 2:  break;
@@ -542,6 +548,8 @@ void ERM19264_UC1609::LCDFillScreen(uint8_t dataPattern)
 */
 void ERM19264_UC1609::LCDBitmap(int16_t x, int16_t y, uint8_t w, uint8_t h, const std::span<const uint8_t> data)
 {
+	auto busLock = SPIBusLock();
+	_pageBuffer.resendAll();
 	switch (GetCommMode())
 	{
 		case 2: ; break;
@@ -552,6 +560,8 @@ void ERM19264_UC1609::LCDBitmap(int16_t x, int16_t y, uint8_t w, uint8_t h, cons
 	uint16_t offset = 0;
 	uint8_t column = (x < 0) ? 0 : x;
 	uint8_t page = (y < 0) ? 0 : y >>3;
+	uint8_t rowData[256];
+	uint16_t count = 0;
 
 	for (ty = 0; ty < h; ty = ty + 8)
 	{
@@ -560,12 +570,14 @@ void ERM19264_UC1609::LCDBitmap(int16_t x, int16_t y, uint8_t w, uint8_t h, cons
 		sendCommand(UC1609_SET_COLADD_MSB, (column & 0xF0) >> 4);
 		sendCommand(UC1609_SET_PAGEADD, page++);
 
+		count = 0;
 		for (tx = 0; tx < w; tx++)
 		{
 			if (x + tx < 0 || x + tx >= _LCD_WIDTH) {continue;}
 			offset = (w * (ty >> 3)) + tx;
-			sendData(data[offset]);
+			rowData[count++] = data[offset];
 		}
+		sendData(std::span<const uint8_t>(rowData, count));
 	}
 
 	switch (GetCommMode())
@@ -605,6 +617,7 @@ void ERM19264_UC1609::SoftwareSPIShiftOut(uint8_t value)
 */
 void ERM19264_UC1609::sendData(uint8_t dataByte)
 {
+	auto busLock = SPIBusLock();
 	int spiErrorStatus = 0;
 	char TransmitBuffer[1];
 	TransmitBuffer[0] = dataByte;
@@ -621,11 +634,37 @@ void ERM19264_UC1609::sendData(uint8_t dataByte)
 	}
 }
 
+/*!
+	 @brief Send data bytes with SPI to UC1609
+	 @param data the data bytes to send
+	 @details Hardware SPI sends them in one transfer, not one per byte.
+*/
+void ERM19264_UC1609::sendData(std::span<const uint8_t> data)
+{
+	auto busLock = SPIBusLock();
+	int spiErrorStatus = 0;
+	switch (GetCommMode())
+	{
+		case 2: 
+			if (data.empty()) break;
+			spiErrorStatus = Display_SPI_WRITE( _spiHandle, reinterpret_cast<const char*>(data.data()), data.size());
+			if (spiErrorStatus <0) 
+			{
+				fprintf(stderr, "Error : Failure to Write  SPI :(%s)\n", lguErrorText(spiErrorStatus));
+			}
+		break;
+		case 3: for (uint8_t dataByte : data) SoftwareSPIShiftOut(dataByte); break;
+	}
+}
+
 /*!
 	@brief updates the buffer i.e. writes it to the screen
 	@return 
 		-# Success 
 		-# BufferEmpty if buffer is empty object
+	@details Only the columns changed since the last update are sent, each changed
+		page gets its column and page address commands then its changed bytes.
+		Unchanged pages are skipped. Blocks until sent, see commitAsync to send in the background.
 */
 rdlib::Return_Codes_e ERM19264_UC1609::LCDupdate()
 {
@@ -634,11 +673,41 @@ rdlib::Return_Codes_e ERM19264_UC1609::LCDupdate()
 		fprintf(stderr, "Error: LCDupdate: Buffer is empty, cannot update screen\r\n");
 		return rdlib::BufferEmpty;
 	}
-	uint8_t x = 0;
-	uint8_t y = 0;
-	uint8_t w = this->_LCD_WIDTH;
-	uint8_t h = this->_LCD_HEIGHT;
-	LCDBuffer( x,  y,  w,  h, this->_LCDbufferScreen);
+	updateFrame(_LCDbufferScreen);
+	return rdlib::Success;
+}
+
+/*!
+	@brief Sends the changed columns of a frame, used by LCDupdate and commitAsync
+	@param frame screen buffer or a committed copy of it
+	@param dirty column range to send of each page
+	@return rdlib::Success
+*/
+rdlib::Return_Codes_e ERM19264_UC1609::sendFrame(std::span<const uint8_t> frame,
+		std::span<const page_buffer_1bpp::DirtyRange_t> dirty)
+{
+	auto busLock = SPIBusLock();
+	switch (GetCommMode())
+	{
+		case 2: ; break;
+		case 3: Display_CS_SetLow; break;
+	}
+
+	const uint8_t pages = std::min<size_t>(_LCD_PAGE_NUM, dirty.size());
+	for (uint8_t page = 0; page < pages; page++)
+	{
+		if (dirty[page].first > dirty[page].last) continue;
+		sendCommand(UC1609_SET_COLADD_LSB, (dirty[page].first & 0x0F));
+		sendCommand(UC1609_SET_COLADD_MSB, (dirty[page].first & 0xF0) >> 4);
+		sendCommand(UC1609_SET_PAGEADD, page);
+		sendData(frame.subspan((page * _LCD_WIDTH) + dirty[page].first, dirty[page].last - dirty[page].first + 1));
+	}
+
+	switch (GetCommMode())
+	{
+		case 2: break;
+		case 3: Display_CS_SetHigh; break;
+	}
 	return rdlib::Success;
 }
 
@@ -656,6 +725,7 @@ rdlib::Return_Codes_e ERM19264_UC1609::LCDclearBuffer()
 		return rdlib::BufferEmpty;
 	}
 	std::fill(_LCDbufferScreen.begin(), _LCDbufferScreen.end(), 0x00);
+	_pageBuffer.markAllDirty();
 	return rdlib::Success;
 }
 
@@ -666,10 +736,12 @@ rdlib::Return_Codes_e ERM19264_UC1609::LCDclearBuffer()
 	 @param w width 0-192
 	 @param h height 0-64
 	 @param data span to the data array
-	 @note Called by LCDupdate internally to write buffer to screen , can be called standalone 	as well
+	 @note Writes direct to screen. The screen buffer is sent in full by the next LCDupdate.
 */
 void ERM19264_UC1609::LCDBuffer(int16_t x, int16_t y, uint8_t w, uint8_t h, std::span<uint8_t> data)
 {
+	auto busLock = SPIBusLock();
+	_pageBuffer.resendAll();
 	switch (GetCommMode())
 	{
 		case 2: ; break;
@@ -680,6 +752,8 @@ void ERM19264_UC1609::LCDBuffer(int16_t x, int16_t y, uint8_t w, uint8_t h, std:
 	uint16_t offset = 0;
 	uint8_t column = (x < 0) ? 0 : x;
 	uint8_t page = (y < 0) ? 0 : y/8;
+	uint8_t rowData[256];
+	uint16_t count = 0;
 
 	for (ty = 0; ty < h; ty = ty + 8)
 	{
@@ -689,12 +763,14 @@ void ERM19264_UC1609::LCDBuffer(int16_t x, int16_t y, uint8_t w, uint8_t h, std:
 		sendCommand(UC1609_SET_COLADD_MSB, (column & 0XF0) >> 4);
 		sendCommand(UC1609_SET_PAGEADD, page++);
 
+		count = 0;
 		for (tx = 0; tx < w; tx++)
 		{
 			if (x + tx < 0 || x + tx >= _LCD_WIDTH) {continue;}
 			offset = (w * (ty /8)) + tx;
-			sendData(data[offset++]);
+			rowData[count++] = data[offset];
 		}
+		sendData(std::span<const uint8_t>(rowData, count));
 	}
 
 	switch (GetCommMode())
@@ -704,45 +780,6 @@ void ERM19264_UC1609::LCDBuffer(int16_t x, int16_t y, uint8_t w, uint8_t h, std:
 	}
 }
 
-/*!
-	@brief Draws a Pixel to the screen , overrides the  graphics library
-	@param x x co-ord of pixel
-	@param y y co-ord of pixel
-	@param colour colour of  pixel
-*/
-void ERM19264_UC1609::drawPixel(int16_t x, int16_t y, uint8_t colour)
-{
-	if ((x < 0) || (x >= this->_width) || (y < 0) || (y >= this->_height)){return;}
-
-	int16_t temp;
-	uint8_t rotation = getRotation();
-	switch (rotation)
-	{
-		case 1:
-			temp = x;
-			x = WIDTH - 1 - y;
-			y = temp;
-		break;
-		case 2:
-			x = WIDTH - 1 - x;
-			y = HEIGHT - 1 - y;
-		break;
-		case 3:
-			temp = x;
-			x = y;
-			y = HEIGHT - 1 - temp;
-		break;
-	}
-	uint16_t tc = (_LCD_WIDTH * (y /8)) + x;
-	switch (colour)
-	{
-		case WHITE:  this->_LCDbufferScreen[tc] &= ~(1 << (y & 7)); break;
-		case BLACK:  this->_LCDbufferScreen[tc] |= (1 << (y & 7)); break;
-		case INVERSE: this->_LCDbufferScreen[tc] ^= (1 << (y & 7)); break;
-	}
-
-}
-
 /*!
 	@brief Freq delay used in SW SPI getter, uS delay used in CustomshiftOut method
 	@return _LCD_HighFreqDelay
@@ -778,6 +815,7 @@ rdlib::Return_Codes_e ERM19264_UC1609::LCDSetBufferPtr(uint8_t width, uint8_t he
 		return rdlib::BufferEmpty;
 	}
 	_LCDbufferScreen = buffer;
+	setPageBuffer(_LCDbufferScreen, _LCD_WIDTH);
 	return rdlib::Success;
 }
 
@@ -63,6 +63,7 @@ rdlib::Return_Codes_e display_Fonts::setFont(display_Font_name_e FontChoice) {
 	_FontOffset   = SelectedFontName[2];
 	_FontNumChars = SelectedFontName[3];
 	_FontInverted = false;
+	_FontColumns = {};
 
 	return rdlib::Success;
 }
@@ -82,6 +83,57 @@ void display_Fonts::setInvertFont(bool invertStatus) {
 bool display_Fonts::getInvertFont()
 { return _FontInverted; }
 
+/*!
+	@brief Get the active font transposed to column-major pages, for 1-bit page layout displays
+	@return span to the glyphs, empty if it could not be built
+	@details Each glyph is (Font_Y_Size+7)/8 page rows of Font_X_Size bytes, one byte per
+		column, LSB at top, the same layout as the bicolor screen buffers. Built on the first
+		call for each font and cached for the life of the program, shared by all displays.
+*/
+std::span<const uint8_t> display_Fonts::getFontColumns(void)
+{
+	if (!_FontColumns.empty())
+		return _FontColumns;
+
+	static std::mutex cacheMutex;
+	static std::map<const uint8_t*, std::vector<uint8_t>> cache;
+	std::lock_guard<std::mutex> lock(cacheMutex);
+	auto found = cache.find(_FontSelect.data());
+	if (found == cache.end())
+	{
+		const uint16_t pages = (_Font_Y_Size + 7) / 8;
+		const size_t rowMajorSize = (static_cast<size_t>(_Font_X_Size) * _Font_Y_Size) / 8;
+		const size_t glyphCount = _FontNumChars + 1U; // writeChar accepts offset to offset+NumChars
+		if (_FontSelect.size() < 4 + (glyphCount * rowMajorSize))
+			return {};
+		std::vector<uint8_t> columns;
+		try
+		{
+			columns.assign(glyphCount * pages * _Font_X_Size, 0);
+		} catch (const std::bad_alloc&) {
+			fprintf(stderr, "Error: getFontColumns: Memory allocation failed\n");
+			return {};
+		}
+		for (size_t glyph = 0; glyph < glyphCount; glyph++)
+		{
+			const uint8_t* rowMajor = _FontSelect.data() + 4 + (glyph * rowMajorSize);
+			uint8_t* columnMajor = columns.data() + (glyph * pages * _Font_X_Size);
+			size_t bit = 0;
+			for (uint16_t cy = 0; cy < _Font_Y_Size; cy++)
+			{
+				for (uint16_t cx = 0; cx < _Font_X_Size; cx++, bit++)
+				{
+					if (rowMajor[bit / 8] & (0x80 >> (bit % 8)))
+						columnMajor[((cy / 8) * _Font_X_Size) + cx] |= static_cast<uint8_t>(1 << (cy % 8));
+				}
+			}
+		}
+		found = cache.emplace(_FontSelect.data(), std::move(columns)).first;
+	}
+	_FontColumns = found->second;
+	return _FontColumns;
+}
+
 // === End of Font class implementation ===
 
 
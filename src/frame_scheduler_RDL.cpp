@@ -0,0 +1,287 @@
+/*!
+	@file     frame_scheduler_RDL.cpp
+	@author   Gavin Lyons
+	@brief    Source file for frame pacing of 16 bit color displays.
+*/
+
+#include "../include/frame_scheduler_RDL.hpp"
+
+/*!
+	@brief Constructor for class frame_scheduler, flushes with writeBuffer()
+	@param display A color 16 bit display in Advanced Screen Buffer mode
+	@param targetFps Target frames per second 1-1000
+*/
+frame_scheduler::frame_scheduler(color16_graphics& display, uint16_t targetFps)
+{
+	_flushFunc = [&display]() { return display.writeBuffer(); };
+	setTargetFps(targetFps);
+}
+
+/*!
+	@brief Constructor for class frame_scheduler with user flush function
+	@param flushFunc Function called to flush each frame, e.g. a dirty region flush
+	@param targetFps Target frames per second 1-1000
+	@note A flush function that does not touch hardware allows the timing to be tested
+		without a display, together with TearSource_e::Simulated.
+*/
+frame_scheduler::frame_scheduler(FlushFunc_t flushFunc, uint16_t targetFps)
+	: _flushFunc(std::move(flushFunc))
+{
+	setTargetFps(targetFps);
+}
+
+/*!
+	@brief Destructor for class frame_scheduler, releases TE GPIO if claimed
+*/
+frame_scheduler::~frame_scheduler()
+{
+	if (_tearSource == TearSource_e::GpioAlert)
+		TearSyncEnd();
+}
+
+/*!
+	@brief Set the target frame rate, restarts the frame clock
+	@param fps Target frames per second 1-1000
+	@return
+		-# rdlib::Success
+		-# rdlib::GenericError fps out of range, setting unchanged
+*/
+rdlib::Return_Codes_e frame_scheduler::setTargetFps(uint16_t fps)
+{
+	if (fps == 0 || fps > 1000)
+	{
+		fprintf(stderr, "Error: setTargetFps: fps must be 1-1000 : %u\n", fps);
+		return rdlib::GenericError;
+	}
+	_targetFps = fps;
+	_framePeriod = std::chrono::duration_cast<FrameClock_t::duration>(std::chrono::microseconds(1000000 / fps));
+	_clockStarted = false;
+	return rdlib::Success;
+}
+
+/*!
+	@brief Get the target frame rate
+	@return target frames per second
+*/
+uint16_t frame_scheduler::getTargetFps(void) const {return _targetFps;}
+
+/*!
+	@brief Set the function called to flush each frame
+	@param flushFunc flush function, e.g. a lambda calling writeBuffer or a dirty region flush
+*/
+void frame_scheduler::setFlushFunction(FlushFunc_t flushFunc)
+{
+	_flushFunc = std::move(flushFunc);
+}
+
+/*!
+	@brief Restart the frame clock, next presentFrame flushes immediately
+	@details Call after a deliberate pause (menu, sleep) so the pause is not counted as missed frames.
+*/
+void frame_scheduler::restartClock(void)
+{
+	_clockStarted = false;
+}
+
+/*!
+	@brief Check if the next frame slot has been reached
+	@return true if presentFrame would flush without sleeping
+	@details Lets a render loop do other work instead of blocking in presentFrame.
+*/
+bool frame_scheduler::frameDue(void) const
+{
+	return !_clockStarted || FrameClock_t::now() >= _nextDeadline;
+}
+
+/*!
+	@brief Wait for the next frame slot (and TE edge if enabled) then flush the frame
+	@details If called one or more whole frame periods late, the missed slots are skipped,
+		the frame is flushed straight away and the schedule realigns to the frame grid.
+	@return
+		-# rdlib::Success
+		-# rdlib::GenericError no flush function set
+		-# Any error code returned by the flush function, e.g. writeBuffer
+*/
+rdlib::Return_Codes_e frame_scheduler::presentFrame(void)
+{
+	if (!_flushFunc)
+	{
+		fprintf(stderr, "Error: presentFrame: No flush function set\n");
+		return rdlib::GenericError;
+	}
+
+	FrameClock_t::time_point now = FrameClock_t::now();
+	if (!_clockStarted)
+	{
+		_nextDeadline = now;
+		_clockStarted = true;
+	}
+
+	if (now < _nextDeadline)
+	{
+		std::this_thread::sleep_until(_nextDeadline);
+	}
+	else
+	{
+		auto lateness = now - _nextDeadline;
+		auto latenessUS = std::chrono::duration_cast<std::chrono::microseconds>(lateness);
+		if (latenessUS > _stats.worstLateness)
+			_stats.worstLateness = latenessUS;
+		// Behind by a whole period or more : drop the missed slots, do not burst to catch up
+		auto slotsMissed = lateness / _framePeriod;
+		if (slotsMissed > 0)
+		{
+			_stats.missedDeadlines++;
+			_stats.framesSkipped += static_cast<uint32_t>(slotsMissed);
+			_nextDeadline += slotsMissed * _framePeriod;
+			if (rdlib_config::isDebugEnabled())
+			{
+				fprintf(stderr, "Warning: presentFrame: Missed deadline by %lld uS, %lld frames skipped\n",
+					static_cast<long long>(latenessUS.count()), static_cast<long long>(slotsMissed));
+			}
+		}
+	}
+
+	if (_tearSource != TearSource_e::Off)
+	{
+		// Do not stall the display if the TE edge never comes, wait at most one period
+		if (!waitForTearEdge(FrameClock_t::now() + _framePeriod))
+			_stats.tearTimeouts++;
+	}
+
+	FrameClock_t::time_point flushStart = FrameClock_t::now();
+	rdlib::Return_Codes_e returnCode = _flushFunc();
+	_stats.lastFlushTime = std::chrono::duration_cast<std::chrono::microseconds>(FrameClock_t::now() - flushStart);
+	_stats.framesPresented++;
+	_nextDeadline += _framePeriod;
+	return returnCode;
+}
+
+/*!
+	@brief Start TE sync using lgpio alerts on the GPIO wired to the controller TE output
+	@param gpioHandle handle to a gpiochip device opened by lgGpiochipOpen
+	@param teGpio GPIO number wired to TE pin
+	@return
+		-# rdlib::Success
+		-# rdlib::GpioPinClaim Failed to claim GPIO for alerts or register callback
+	@note The controller TE output must also be enabled, e.g. ILI9341 tearingEffect(true)
+		or ST7789 TFTtearingEffect(true).
+*/
+rdlib::Return_Codes_e frame_scheduler::TearSyncGpioBegin(int gpioHandle, int teGpio)
+{
+	if (_tearSource != TearSource_e::Off)
+		TearSyncEnd();
+
+	int GpioStatus = lgGpioClaimAlert(gpioHandle, 0, LG_RISING_EDGE, teGpio, -1);
+	if (GpioStatus < 0)
+	{
+		fprintf(stderr, "Error: TearSyncGpioBegin: Can't claim TE GPIO for alerts (%s)\n", lguErrorText(GpioStatus));
+		return rdlib::GpioPinClaim;
+	}
+	GpioStatus = lgGpioSetAlertsFunc(gpioHandle, teGpio, tearAlertCallback, this);
+	if (GpioStatus < 0)
+	{
+		fprintf(stderr, "Error: TearSyncGpioBegin: Can't set TE alert function (%s)\n", lguErrorText(GpioStatus));
+		lgGpioFree(gpioHandle, teGpio);
+		return rdlib::GpioPinClaim;
+	}
+	_tearGpioHandle = gpioHandle;
+	_tearGpio = teGpio;
+	_tearSource = TearSource_e::GpioAlert;
+	return rdlib::Success;
+}
+
+/*!
+	@brief Start TE sync from a simulated source
+	@details Flushes then wait for signalTearEdge() calls, e.g. from a thread
+		ticking at the panel refresh rate, so TE timing can be tested without hardware.
+	@return rdlib::Success
+*/
+rdlib::Return_Codes_e frame_scheduler::TearSyncSimulatedBegin(void)
+{
+	if (_tearSource != TearSource_e::Off)
+		TearSyncEnd();
+	_tearSource = TearSource_e::Simulated;
+	return rdlib::Success;
+}
+
+/*!
+	@brief Stop TE sync, frees the TE GPIO in GpioAlert mode
+	@return
+		-# rdlib::Success
+		-# rdlib::GpioPinFree Failed to free TE GPIO
+*/
+rdlib::Return_Codes_e frame_scheduler::TearSyncEnd(void)
+{
+	rdlib::Return_Codes_e returnCode = rdlib::Success;
+	if (_tearSource == TearSource_e::GpioAlert)
+	{
+		lgGpioSetAlertsFunc(_tearGpioHandle, _tearGpio, nullptr, nullptr);
+		int GpioStatus = lgGpioFree(_tearGpioHandle, _tearGpio);
+		if (GpioStatus < 0)
+		{
+			fprintf(stderr, "Error: TearSyncEnd: Can't free TE GPIO (%s)\n", lguErrorText(GpioStatus));
+			returnCode = rdlib::GpioPinFree;
+		}
+		_tearGpioHandle = -1;
+		_tearGpio = -1;
+	}
+	_tearSource = TearSource_e::Off;
+	return returnCode;
+}
+
+/*!
+	@brief Get the current TE source
+	@return TearSource_e enum
+*/
+frame_scheduler::TearSource_e frame_scheduler::getTearSource(void) const {return _tearSource;}
+
+/*!
+	@brief Signal a TE edge, wakes a presentFrame waiting on TE
+	@details Called by the lgpio alert callback, or directly by user code in Simulated mode.
+*/
+void frame_scheduler::signalTearEdge(void)
+{
+	{
+		std::lock_guard<std::mutex> lock(_tearMutex);
+		_tearEdgeCount++;
+	}
+	_tearCond.notify_all();
+}
+
+/*!
+	@brief Get the frame timing statistics
+	@return FrameStats_t struct
+*/
+frame_scheduler::FrameStats_t frame_scheduler::getFrameStats(void) const {return _stats;}
+
+/*!
+	@brief Reset the frame timing statistics to zero
+*/
+void frame_scheduler::resetFrameStats(void)
+{
+	_stats = FrameStats_t{};
+}
+
+/// @cond
+
+// lgpio alert thread callback, one alert per TE rising edge
+void frame_scheduler::tearAlertCallback(int numAlerts, lgGpioAlert_p alerts, void *userdata)
+{
+	(void)alerts;
+	frame_scheduler* scheduler = static_cast<frame_scheduler*>(userdata);
+	if (scheduler != nullptr && numAlerts > 0)
+		scheduler->signalTearEdge();
+}
+
+// Block until a TE edge newer than the call arrives, false on timeout
+bool frame_scheduler::waitForTearEdge(FrameClock_t::time_point limit)
+{
+	std::unique_lock<std::mutex> lock(_tearMutex);
+	uint32_t startCount = _tearEdgeCount;
+	return _tearCond.wait_until(lock, limit, [this, startCount]() { return _tearEdgeCount != startCount; });
+}
+
+/// @endcond
+
+// **************** EOF *****************
@@ -6,6 +6,7 @@
 
 // Section : Includes
 #include "../../include/hd44780/HD44780_LCD_RDL.hpp"
+#include <algorithm>
 
 /*!
 	@brief Constructor for class HD44780PCF8574LCD
@@ -22,6 +23,7 @@ HD44780PCF8574LCD::HD44780PCF8574LCD(uint8_t NumRow, uint8_t NumCol, int I2CDevi
 	_LCDI2CDevice = I2CDevice;
 	_LCDI2CAddress = I2Caddress;
 	_LCDI2CFlags = I2CFlags;
+	_DDRAMShadow.assign((_NumRowsLCD > 4) ? 4 : _NumRowsLCD, led_segment_shadow(_NumColsLCD));
 }
 
 // Section : methods
@@ -66,6 +68,65 @@ void HD44780PCF8574LCD::LCDSendData(unsigned char data) {
 	_I2C_ErrorFlag = ErrorCode;
 }
 
+/*!
+	@brief  Send a run of data bytes to LCD, batched into as few I2C writes as possible
+	@param data The data bytes to send
+	@param length Number of bytes
+	@details Each byte is the same 4 PCF8574 writes as LCDSendData, upper nibble then lower,
+		each with enable high then low. Those of many bytes are packed into one I2C write of up to
+		_I2CBurstSize bytes, saving the start, address and stop of every 4 byte transaction.
+	@note A failed write is retried in whole, as with LCDSendData.
+	@return true if every I2C write succeeded
+*/
+bool HD44780PCF8574LCD::LCDSendDataRun(const uint8_t *data, size_t length) {
+	bool result = true;
+
+	// I2C MASK Byte = DATA-led-en-rw-rs (en=enable rs = reg select)(rw always write)
+	const uint8_t LCDDataByteOn= 0x0D; //enable=1 and rs =1 1101  DATA-led-en-rw-rs
+	const  uint8_t LCDDataByteOff = 0x09; // enable=0 and rs =1 1001 DATA-led-en-rw-rs
+	const uint8_t byteOn = LCDDataByteOn & _LCDBackLight;
+	const uint8_t byteOff = LCDDataByteOff & _LCDBackLight;
+
+	const size_t charsPerWrite = _I2CBurstSize / 4;
+	char dataBufferI2C[I2CBurstSizeMax];
+
+	while (length > 0)
+	{
+		size_t chunk = (length < charsPerWrite) ? length : charsPerWrite;
+		for (size_t i = 0; i < chunk; i++)
+		{
+			unsigned char dataNibbleUpper = data[i] & 0xf0; //select upper nibble
+			unsigned char dataNibbleLower = (data[i] << 4) & 0xf0; //select lower nibble by moving it to the upper nibble position
+			dataBufferI2C[i * 4] = dataNibbleUpper | byteOn;
+			dataBufferI2C[i * 4 + 1] = dataNibbleUpper | byteOff;
+			dataBufferI2C[i * 4 + 2] = dataNibbleLower | byteOn;
+			dataBufferI2C[i * 4 + 3] = dataNibbleLower | byteOff;
+		}
+
+		uint8_t AttemptCount = _I2C_ErrorRetryNum;
+		int ErrorCode = Display_RDL_I2C_WRITE (_LCDI2CHandle, dataBufferI2C, static_cast<int>(chunk * 4));
+		// Error handling retransmit
+		while(ErrorCode < 0)
+		{
+			if (rdlib_config::isDebugEnabled())
+			{
+				fprintf(stderr, "Error:  LCDSendDataRun I2C: (%s) \n", lguErrorText(ErrorCode) );
+				fprintf(stderr, "Attempt Count: %u \n", AttemptCount );
+			}
+			delayMilliSecRDL(_I2C_ErrorDelay );
+			ErrorCode = Display_RDL_I2C_WRITE (_LCDI2CHandle, dataBufferI2C, static_cast<int>(chunk * 4)); // retransmit
+			_I2C_ErrorFlag = ErrorCode;
+			AttemptCount--;
+			if (AttemptCount == 0) break;
+		}
+		_I2C_ErrorFlag = ErrorCode;
+		if (ErrorCode < 0) result = false;
+		data += chunk;
+		length -= chunk;
+	}
+	return result;
+}
+
 /*!
 	@brief  Send command byte to lcd
 	@param cmd command byte
@@ -113,6 +174,15 @@ void HD44780PCF8574LCD::LCDSendCmd(unsigned char cmd) {
 */
 void HD44780PCF8574LCD::LCDClearLine(LCDLineNumber_e lineNo) {
 
+	const uint8_t row = lineNo - 1;
+	if (_bufferMode)
+	{
+		if (row >= _DDRAMShadow.size()) return;
+		for (uint8_t col = 0; col < _NumColsLCD; col++)
+			_DDRAMShadow[row].stage(col, ' ');
+		return;
+	}
+
 	switch (lineNo) {
 		case LCDLineNumberOne:LCDSendCmd(LCDLineAddressOne); break;
 		case LCDLineNumberTwo:LCDSendCmd(LCDLineAddressTwo); break;
@@ -132,14 +202,20 @@ void HD44780PCF8574LCD::LCDClearLine(LCDLineNumber_e lineNo) {
 		break;
 	}
 
-	for (uint8_t i = 0; i < _NumColsLCD; i++) {
-		LCDSendData(' ');
-	}
+	uint8_t spaces[UINT8_MAX];
+	std::fill_n(spaces, _NumColsLCD, ' ');
+	bool success = (_I2C_ErrorFlag >= 0);
+	success = LCDSendDataRun(spaces, _NumColsLCD) && success;
+	if (!success)
+		LCDShadowInvalidate();
+	else if (row < _DDRAMShadow.size())
+		LCDShadowCleared(row);
 }
 
 /*!
 	@brief  Clear screen by writing spaces to every position
 	@note : See also LCDClearScreenCmd for software command clear alternative.
+		In buffer mode clears the virtual screen, LCDFlush then sends only what was not blank.
 	@return 
 		-#  Success
 		-#  GenericError of number of rows invalid 
@@ -179,6 +255,9 @@ void HD44780PCF8574LCD::LCDResetScreen(LCDCursorType_e CursorType) {
 	LCDSendCmd(LCDCmdClearScreen);
 	LCDSendCmd(LCDEntryModeThree);
 	delayMilliSecRDL(5);
+	_LCDCursorType = CursorType;
+	_LCDEntryMode = LCDEntryModeThree;
+	LCDShadowCleared(-1);
 }
 
 /*!
@@ -188,6 +267,7 @@ void HD44780PCF8574LCD::LCDResetScreen(LCDCursorType_e CursorType) {
 void HD44780PCF8574LCD::LCDDisplayON(bool OnOff) {
 	OnOff ? LCDSendCmd(LCDCmdDisplayOn) : LCDSendCmd(LCDCmdDisplayOff);
 	delayMilliSecRDL(5);
+	_LCDCursorType = LCDCursorTypeOff; // both commands hide the cursor
 }
 
 
@@ -210,6 +290,9 @@ void HD44780PCF8574LCD::LCDInit(LCDCursorType_e CursorType) {
 	LCDSendCmd(LCDEntryModeThree);
 	LCDSendCmd(LCDCmdClearScreen);
 	delayMilliSecRDL(5);
+	_LCDCursorType = CursorType;
+	_LCDEntryMode = LCDEntryModeThree;
+	LCDShadowCleared(-1);
 }
 
 /*!
@@ -235,7 +318,8 @@ rdlib::Return_Codes_e HD44780PCF8574LCD::LCDSendString(char *str)
 		fprintf(stderr, "Error: LCDSendString 2: String length is larger than screen.\n");
 		return rdlib::CustomCharLen;
 	}
-	while (*str) LCDSendData(*str++);
+	if (!LCDBufferRedirect(reinterpret_cast<const uint8_t*>(str), strlen(str)))
+		LCDSendDataRun(reinterpret_cast<const uint8_t*>(str), strlen(str));
 	return rdlib::Success;
 }
 
@@ -245,7 +329,9 @@ rdlib::Return_Codes_e HD44780PCF8574LCD::LCDSendString(char *str)
 	@param data Character to display
 */
 void HD44780PCF8574LCD::LCDSendChar(char data) {
-	LCDSendData(data);
+	const uint8_t character = data;
+	if (!LCDBufferRedirect(&character, 1))
+		LCDSendData(data);
 }
 
 
@@ -253,8 +339,17 @@ void HD44780PCF8574LCD::LCDSendChar(char data) {
 	@brief  Moves cursor
 	@param direction enum LCDDirectionType_e left or right
 	@param moveSize number of spaces to move
+	@note In buffer mode moves the virtual screen cursor within its row.
 */
 void HD44780PCF8574LCD::LCDMoveCursor(LCDDirectionType_e direction, uint8_t moveSize) {
+	if (_bufferMode)
+	{
+		if (direction == LCDMoveRight)
+			_bufferCol = (_bufferCol + moveSize < _NumColsLCD) ? _bufferCol + moveSize : _NumColsLCD;
+		else if (direction == LCDMoveLeft)
+			_bufferCol = (_bufferCol > moveSize) ? _bufferCol - moveSize : 0;
+		return;
+	}
 	uint8_t i = 0;
 	const uint8_t LCDMoveCursorLeft = 0x10;  //Command Byte Code:  Move cursor one character left
 	const uint8_t LCDMoveCursorRight = 0x14;  // Command Byte Code : Move cursor one character right
@@ -303,8 +398,22 @@ void HD44780PCF8574LCD::LCDScroll(LCDDirectionType_e direction, uint8_t ScrollSi
 	@brief  moves cursor to an x , y position on display.
 	@param  line  x row 1-4
 	@param col y column  0-15 or 0-19
+	@note In buffer mode moves the virtual screen cursor, nothing is sent.
 */
 void HD44780PCF8574LCD::LCDGOTO(LCDLineNumber_e line, uint8_t col) {
+	if (_bufferMode)
+	{
+		_bufferRow = line - 1;
+		_bufferCol = col;
+		return;
+	}
+	LCDSetDDRAMCursor(line, col);
+}
+
+/// @cond
+
+// Set the DDRAM address counter, the LCD cursor
+void HD44780PCF8574LCD::LCDSetDDRAMCursor(LCDLineNumber_e line, uint8_t col) {
 
 	switch (line) {
 		case LCDLineNumberOne: LCDSendCmd(LCDLineAddressOne| col); break;
@@ -326,6 +435,124 @@ void HD44780PCF8574LCD::LCDGOTO(LCDLineNumber_e line, uint8_t col) {
 	}
 }
 
+// In buffer mode write data to the virtual screen at its cursor and return true, characters past
+// the end of the row are dropped. Otherwise the data goes to the LCD at an address not tracked,
+// so forget the shadow and return false.
+bool HD44780PCF8574LCD::LCDBufferRedirect(const uint8_t *data, size_t length)
+{
+	if (!_bufferMode)
+	{
+		LCDShadowInvalidate();
+		return false;
+	}
+	for (size_t i = 0; i < length && _bufferCol < _NumColsLCD; i++)
+	{
+		if (_bufferRow < _DDRAMShadow.size())
+			_DDRAMShadow[_bufferRow].stage(_bufferCol, data[i]);
+		_bufferCol++;
+	}
+	return true;
+}
+
+// The LCD was cleared, row 0-3 or -1 for all rows, the virtual screen and shadow are all spaces.
+// If the I2C write failed the DDRAM is unknown instead.
+void HD44780PCF8574LCD::LCDShadowCleared(int8_t row)
+{
+	if (_I2C_ErrorFlag < 0)
+	{
+		LCDShadowInvalidate();
+		return;
+	}
+	for (size_t index = 0; index < _DDRAMShadow.size(); index++)
+	{
+		if (row >= 0 && index != static_cast<size_t>(row)) continue;
+		for (uint8_t col = 0; col < _NumColsLCD; col++)
+			_DDRAMShadow[index].stage(col, ' ');
+		_DDRAMShadow[index].markSent(0, _NumColsLCD, true);
+	}
+}
+
+// Forget what the DDRAM holds, the CGRAM is kept
+void HD44780PCF8574LCD::LCDShadowInvalidate(void)
+{
+	for (auto& row : _DDRAMShadow) row.invalidate();
+}
+
+// Find the CGRAM slot of a glyph, or give it one.
+// A resident glyph is reused. Otherwise the glyph takes a slot no virtual screen cell refers to,
+// one never used first, then the least recently used, and its upload is left to LCDFlush.
+// The cell at the virtual screen cursor is not counted, it is about to be overwritten.
+// Returns the slot 0-7, -1 if all 8 are on the virtual screen.
+int8_t HD44780PCF8574LCD::LCDGlyphAllocate(const uint8_t *glyph)
+{
+	_glyphClock++;
+	for (uint8_t slot = 0; slot < CGRAMSlots; slot++)
+	{
+		if (_glyphSlots[slot].resident && std::equal(_glyphSlots[slot].bitmap.begin(), _glyphSlots[slot].bitmap.end(), glyph))
+		{
+			_glyphSlots[slot].lastUse = _glyphClock;
+			return static_cast<int8_t>(slot);
+		}
+	}
+
+	uint8_t refCount[CGRAMSlots] = {0};
+	for (size_t row = 0; row < _DDRAMShadow.size(); row++)
+	{
+		for (uint8_t col = 0; col < _NumColsLCD; col++)
+		{
+			if (row == _bufferRow && col == _bufferCol) continue;
+			uint8_t character = _DDRAMShadow[row].staged(col);
+			if (character < CGRAMSlots && refCount[character] < 0xFF) refCount[character]++;
+		}
+	}
+	int8_t victim = -1;
+	for (uint8_t slot = 0; slot < CGRAMSlots; slot++)
+	{
+		if (refCount[slot] > 0) continue;
+		if (victim < 0 || _glyphSlots[slot].lastUse < _glyphSlots[victim].lastUse)
+			victim = static_cast<int8_t>(slot);
+	}
+	if (victim < 0) return -1;
+
+	LCDGlyphSlot_t& entry = _glyphSlots[victim];
+	std::copy(glyph, glyph + entry.bitmap.size(), entry.bitmap.begin());
+	entry.resident = true;
+	entry.pending = true;
+	entry.lastUse = _glyphClock;
+	return victim;
+}
+
+// Upload the pending glyphs, consecutive slots in one CGRAM write.
+// Leaves the address counter in CGRAM. Returns false if an I2C write failed, those stay pending.
+bool HD44780PCF8574LCD::LCDGlyphUpload(void)
+{
+	const uint8_t LCD_CG_RAM = 0x40;  //  character-generator RAM (CG RAM address)
+	bool result = true;
+	uint8_t slot = 0;
+	while (slot < CGRAMSlots)
+	{
+		if (!_glyphSlots[slot].pending) {slot++; continue;}
+		uint8_t first = slot;
+		uint8_t data[CGRAMSlots * 8];
+		size_t length = 0;
+		while (slot < CGRAMSlots && _glyphSlots[slot].pending)
+		{
+			std::copy(_glyphSlots[slot].bitmap.begin(), _glyphSlots[slot].bitmap.end(), data + length);
+			length += _glyphSlots[slot].bitmap.size();
+			slot++;
+		}
+		LCDSendCmd(LCD_CG_RAM | (first << 3));
+		bool success = (_I2C_ErrorFlag >= 0);
+		success = LCDSendDataRun(data, length) && success;
+		for (uint8_t index = first; index < slot; index++)
+			_glyphSlots[index].pending = !success;
+		if (!success) result = false;
+	}
+	return result;
+}
+
+/// @endcond
+
 /*!
 	@brief  Saves a custom character to a location in character generator RAM 64 bytes.
 	@param location CG_RAM location 0-7, we only have 8 locations 64 bytes
@@ -348,9 +575,9 @@ rdlib::Return_Codes_e  HD44780PCF8574LCD::LCDCreateCustomChar(uint8_t location,
 	}
 	const uint8_t LCD_CG_RAM = 0x40;  //  character-generator RAM (CG RAM address)
 	LCDSendCmd(LCD_CG_RAM | (location<<3));
-	for (uint8_t i=0; i<8; i++) {
-		LCDSendData(charmap[i]);
-	}
+	LCDSendDataRun(charmap, 8);
+	_glyphSlots[location].resident = false; // LCDPrintGlyph no longer knows what the slot holds
+	_glyphSlots[location].pending = false;
 	return rdlib::Success;
 }
 
@@ -429,7 +656,8 @@ rdlib::Return_Codes_e HD44780PCF8574LCD::LCD_I2C_OFF(void)
 void HD44780PCF8574LCD::LCDPrintCustomChar(uint8_t location)
 {
 	if (location >= 8) {return;}
-	LCDSendData(location);
+	if (!LCDBufferRedirect(&location, 1))
+		LCDSendData(location);
 }
 
 /*!
@@ -444,19 +672,45 @@ size_t HD44780PCF8574LCD::write(uint8_t character)
 	return 1;
 }
 
+/*!
+	@brief  Called by print class, used to print out strings and numbers
+	@param buffer the characters to write
+	@param size number of characters
+	@note used internally. Sends the characters batched in as few I2C writes as possible.
+	@return returns size to the print class
+*/
+size_t HD44780PCF8574LCD::write(const uint8_t *buffer, size_t size)
+{
+	if (buffer == nullptr) return 0;
+	if (!LCDBufferRedirect(buffer, size))
+		LCDSendDataRun(buffer, size);
+	return size;
+}
+
 /*!
 	@brief Clear display using software command , set cursor position to zero
-	@note  See also LCDClearScreen for manual clear
+	@note  See also LCDClearScreen for manual clear.
+		Is sent in buffer mode too, and clears the virtual screen.
 */
 void HD44780PCF8574LCD::LCDClearScreenCmd(void) {
 	LCDSendCmd(LCDCmdClearScreen);
 	delayMilliSecRDL(3); // Requires a delay
+	LCDShadowCleared(-1);
+	_bufferRow = 0;
+	_bufferCol = 0;
 }
 
 /*!
 	@brief Set cursor position to home position .
+	@note In buffer mode moves the virtual screen cursor, nothing is sent.
 */
 void HD44780PCF8574LCD::LCDHome(void) {
+	if (_bufferMode)
+	{
+		_bufferRow = 0;
+		_bufferCol = 0;
+		return;
+	}
 	LCDSendCmd(LCDCmdHomePosition);
 	delayMilliSecRDL(3); // Requires a delay
 }
@@ -469,6 +723,148 @@ void HD44780PCF8574LCD::LCDChangeEntryMode(LCDEntryMode_e newEntryMode)
 {
 	LCDSendCmd(newEntryMode);
 	delayMilliSecRDL(3); // Requires a delay
+	_LCDEntryMode = newEntryMode;
+}
+
+/*!
+	@brief Turn buffer mode on and off
+	@param OnOff true = text goes to the virtual screen, false = text goes to the LCD
+	@details In buffer mode LCDSendString, LCDSendChar, LCDPrintCustomChar, print, LCDClearLine
+		and LCDClearScreen write a virtual screen, LCDGOTO, LCDHome and LCDMoveCursor move its
+		cursor. Nothing is sent until LCDFlush. Text is written left to right whatever the entry mode,
+		characters past the end of a row are dropped.
+		Turning it on blanks the virtual screen, the first LCDFlush sends what differs from the LCD.
+*/
+void HD44780PCF8574LCD::LCDBufferModeSet(bool OnOff)
+{
+	if (OnOff && !_bufferMode)
+	{
+		for (auto& row : _DDRAMShadow)
+			for (uint8_t col = 0; col < _NumColsLCD; col++)
+				row.stage(col, ' ');
+		_bufferRow = 0;
+		_bufferCol = 0;
+	}
+	_bufferMode = OnOff;
+}
+
+/*!
+	@brief Get buffer mode
+	@return true if text goes to the virtual screen
+*/
+bool HD44780PCF8574LCD::LCDBufferModeGet(void) {return _bufferMode;}
+
+/*!
+	@brief Send the changes on the virtual screen to the LCD
+	@details Each run of changed characters on a row is one cursor set and one batched data write,
+		using the DDRAM address auto-increment. Runs up to LCDFlushMaxGap unchanged characters
+		apart are sent as one, as resending a character costs no more than a cursor set.
+		Glyphs new to CGRAM since the last flush are uploaded first.
+		If the entry mode is not LCDEntryModeThree it is set for the flush and restored after.
+		If the cursor is visible it is left at the virtual screen cursor.
+	@return
+		-# Success
+		-# GenericError an I2C write failed, those characters are sent again by the next LCDFlush
+*/
+rdlib::Return_Codes_e HD44780PCF8574LCD::LCDFlush(void)
+{
+	const bool entryModeChange = (_LCDEntryMode != LCDEntryModeThree);
+	bool sent = false;
+	bool result = true;
+	auto beginSend = [&]()
+	{
+		if (!sent && entryModeChange) LCDSendCmd(LCDEntryModeThree);
+		sent = true;
+	};
+
+	bool uploaded = false;
+	for (const auto& slot : _glyphSlots)
+	{
+		if (!slot.pending) continue;
+		beginSend();
+		result = LCDGlyphUpload();
+		uploaded = true;
+		break;
+	}
+
+	bool ddramSent = false;
+	for (size_t row = 0; row < _DDRAMShadow.size(); row++)
+	{
+		bool rowResult = _DDRAMShadow[row].commit(LCDFlushMaxGap, [&](size_t first, std::span<const uint8_t> data) -> bool
+		{
+			beginSend();
+			ddramSent = true;
+			LCDSetDDRAMCursor(static_cast<LCDLineNumber_e>(row + 1), static_cast<uint8_t>(first));
+			bool success = (_I2C_ErrorFlag >= 0);
+			return LCDSendDataRun(data.data(), data.size()) && success;
+		});
+		if (!rowResult) result = false;
+	}
+	if (sent)
+	{
+		if (entryModeChange) LCDSendCmd(_LCDEntryMode);
+		if (_bufferMode && _LCDCursorType != LCDCursorTypeOff && _bufferRow < _DDRAMShadow.size() && _bufferCol < _NumColsLCD)
+			LCDSetDDRAMCursor(static_cast<LCDLineNumber_e>(_bufferRow + 1), _bufferCol);
+		else if (uploaded && !ddramSent)
+			LCDSetDDRAMCursor(LCDLineNumberOne, 0); // leave the address counter in DDRAM
+	}
+	if (!result)
+	{
+		if (rdlib_config::isDebugEnabled())
+			fprintf(stderr, "Error: LCDFlush : I2C write failed, changes are sent again on next flush\n");
+		return rdlib::GenericError;
+	}
+	return rdlib::Success;
+}
+
+/*!
+	@brief Forget what the LCD shows, the next LCDFlush sends the whole virtual screen
+	@details Done for you, without the glyphs, when text is sent to the LCD outside buffer mode.
+		Call it if the LCD was reset, power cycled or written by other code.
+		Glyphs in CGRAM are uploaded again too.
+*/
+void HD44780PCF8574LCD::LCDBufferInvalidate(void)
+{
+	LCDShadowInvalidate();
+	for (auto& slot : _glyphSlots)
+		if (slot.resident) slot.pending = true;
+}
+
+/*!
+	@brief Print a custom character, given by its bitmap, on the virtual screen
+	@param glyph An array of 8 bytes representing a custom character, as LCDCreateCustomChar
+	@details Any number of glyphs can be used over time, at most 8 on screen at once.
+		The glyph is given a CGRAM slot if it has none: a slot not used on the virtual screen,
+		least recently printed first. The 8 byte CGRAM upload is done by the next LCDFlush,
+		so a glyph already in CGRAM costs nothing but its cell.
+	@note Buffer mode only. Slots written by LCDCreateCustomChar may be taken once not on screen.
+	@return codes
+		-# Success
+		-# CharArrayNullptr
+		-# WrongBufferMode buffer mode is off
+		-# InvalidRAMLocation all 8 slots are used on the virtual screen
+*/
+rdlib::Return_Codes_e HD44780PCF8574LCD::LCDPrintGlyph(const uint8_t *glyph)
+{
+	if (glyph == nullptr)
+	{
+		fprintf(stderr ,"Error: LCDPrintGlyph 1: glyph is a null pointer.\n");
+		return rdlib::CharArrayNullptr;
+	}
+	if (!_bufferMode)
+	{
+		fprintf(stderr ,"Error: LCDPrintGlyph 2: buffer mode is off, see LCDBufferModeSet.\n");
+		return rdlib::WrongBufferMode;
+	}
+	int8_t slot = LCDGlyphAllocate(glyph);
+	if (slot < 0)
+	{
+		fprintf(stderr ,"Error: LCDPrintGlyph 3: all 8 CGRAM slots are on screen.\n");
+		return rdlib::InvalidRAMLocation;
+	}
+	const uint8_t character = static_cast<uint8_t>(slot);
+	LCDBufferRedirect(&character, 1);
+	return rdlib::Success;
 }
 
 
@@ -513,6 +909,25 @@ void HD44780PCF8574LCD::LCDI2CErrorRetryNumSet(uint8_t AttemptCount)
 	_I2C_ErrorRetryNum = AttemptCount;
 }
 
+/*!
+	 @brief Gets the most bytes sent in one I2C write when sending a run of characters
+	 @return _I2CBurstSize, 4 bytes per character
+*/
+uint16_t HD44780PCF8574LCD::LCDI2CBurstSizeGet(void){return _I2CBurstSize;}
+
+/*!
+	 @brief Sets the most bytes sent in one I2C write when sending a run of characters
+	 @details Strings and print output are sent 4 bytes per character in as few I2C writes as
+		this allows. Lower it if the I2C adapter limits the length of a write, default 128.
+	 @param burstSize bytes per I2C write, 4 to I2CBurstSizeMax, rounded down to a multiple of 4
+*/
+void HD44780PCF8574LCD::LCDI2CBurstSizeSet(uint16_t burstSize)
+{
+	if (burstSize < 4) burstSize = 4;
+	if (burstSize > I2CBurstSizeMax) burstSize = I2CBurstSizeMax;
+	_I2CBurstSize = static_cast<uint16_t>(burstSize & ~0x03);
+}
+
 
 /*!
 	@brief checks if LCD on I2C bus
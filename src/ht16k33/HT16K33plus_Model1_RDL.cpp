@@ -184,6 +184,7 @@ int HT16K33plus_Model1::DisplayCheckConnection(void)
 	@param blinklevel Blink frequency setting (enumeration BlinkFreq_e 4 settings).
 	@param numOfDigits Number of digits to be displayed.
 	@param displayType Type of display configuration (enumeration DisplayType_e 4 settings).
+	@details The display RAM is cleared, its content is undefined at power on.
 */
 void HT16K33plus_Model1::DisplayInit(uint8_t brightLevel, BlinkFreq_e  blinklevel, uint8_t numOfDigits, DisplayType_e displayType)
 {
@@ -198,6 +199,40 @@ void HT16K33plus_Model1::DisplayInit(uint8_t brightLevel, BlinkFreq_e  blinkleve
 	_brightness = brightLevel;
 	_numOfDigits = numOfDigits;
 	_displayType = displayType;
+	for (uint8_t address = 0; address < HT16K33_RAM_SIZE; address++)
+		_displayRAM.stage(address, 0x00);
+	_displayRAM.invalidate(); // written in one I2C write whatever the shadow holds
+	commitFrame();
+}
+
+/*!
+	@brief Forget the shadow copy of the display RAM
+	@details Digit writes are skipped when the data is already on the display.
+		Call this if the module was power cycled, the next write of each digit is sent.
+*/
+void HT16K33plus_Model1::invalidateShadow(void)
+{
+	_displayRAM.invalidate();
+}
+
+/*!
+	@brief Write the staged display RAM to the display in one I2C write
+	@details The changed bytes are sent in one auto increment I2C write from the first to the last,
+		unchanged bytes in between are resent as that costs less than another I2C write.
+		After DisplayInit or invalidateShadow that is the whole 16 byte display RAM image.
+		Nothing is sent if nothing changed.
+	@note The display functions call this, call it after staging with stageRawData.
+*/
+void HT16K33plus_Model1::commitFrame(void)
+{
+	_displayRAM.commit(HT16K33_RAM_SIZE, [this](size_t first, std::span<const uint8_t> data)
+	{
+		uint8_t txDataBuffer[HT16K33_RAM_SIZE + 1];
+		txDataBuffer[0] = HT16K33_DDAPTR + first;
+		std::copy(data.begin(), data.end(), txDataBuffer + 1);
+		SendData(txDataBuffer, data.size() + 1);
+		return _I2C_ErrorFlag >= 0;
+	});
 }
 
 /*!
@@ -266,6 +301,14 @@ HT16K33plus_Model1::DisplayType_e HT16K33plus_Model1::getDisplayType() const{
 	return  _displayType;
 }
 
+/*!
+	@brief Gets the number of digits.
+	@returns The number of digits set by DisplayInit.
+*/
+uint8_t HT16K33plus_Model1::getNumOfDigits() const{
+	return  _numOfDigits;
+}
+
 /*!
 	@brief Sets the display brightness level.
 	@param value Brightness level (0-15). If greater than 15, it defaults to 15.
@@ -297,11 +340,26 @@ uint8_t HT16K33plus_Model1::getBrightness() const{
 	@param decimalOnPoint Specifies whether the decimal point should be enabled (enumeration DecimalPoint_e).
 	@returns Return code indicating success or an error (enumeration rdlib::Return_Codes_e).
 	@details If the character is out of the supported ASCII font range, an error is logged and a corresponding error code is returned.
-	         If the display type is not 7-segment, the function delegates to displayMultiSegNum().
-	         Otherwise, the function retrieves the 7-segment font data, applies the decimal point if needed, 
-	         and sends the data to the display.
+	         Not sent if the character is already on the display.
 */
 rdlib::Return_Codes_e HT16K33plus_Model1::displayChar(uint8_t digitPosition, char character, DecimalPoint_e decimalOnPoint)
+{
+	rdlib::Return_Codes_e result = stageChar(digitPosition, character, decimalOnPoint);
+	commitFrame();
+	return result;
+}
+
+/*!
+	@brief Stages a single character at the specified digit position for the next commitFrame.
+	@param digitPosition The position of the digit on the display (0-based index 0 = LHS).
+	@param character The ASCII character to display.
+	@param decimalOnPoint Specifies whether the decimal point should be enabled (enumeration DecimalPoint_e).
+	@returns Return code indicating success or an error (enumeration rdlib::Return_Codes_e).
+	@details If the display type is not 7-segment, the function delegates to displayMultiSegNum().
+	         Otherwise, the function retrieves the 7-segment font data, applies the decimal point if needed,
+	         and stages the data in the display RAM shadow.
+*/
+rdlib::Return_Codes_e HT16K33plus_Model1::stageChar(uint8_t digitPosition, char character, DecimalPoint_e decimalOnPoint)
 {
 	if (character <= (_HT_ASCIIOffset-1) || character >= _HT_ASCIIEnd)
 	{// check ASCII font bounds
@@ -311,15 +369,7 @@ rdlib::Return_Codes_e HT16K33plus_Model1::displayChar(uint8_t digitPosition, cha
 	if (_displayType != SegType7){
 			return displayMultiSegNum(digitPosition, character, decimalOnPoint);
 	} else {
-		uint8_t characterConverted;
-		const uint8_t* font = SevenSegmentFont::pFontSevenSegptr();
-		characterConverted = font[character- _HT_ASCIIOffset];
-		if (decimalOnPoint ==  DecPointOn) characterConverted |= _HT_DEC_POINT_7_MASK;
-		uint8_t txDataBuffer[2];
-		size_t length = sizeof(txDataBuffer);
-		txDataBuffer[0] = digitPosition*2;
-		txDataBuffer[1] = characterConverted;
-		SendData(txDataBuffer, length);
+		_displayRAM.stage(digitPosition*2, getCharSegments(character, decimalOnPoint) & 0x00FF);
 	}
 	return rdlib::Success;
 }
@@ -332,16 +382,35 @@ rdlib::Return_Codes_e HT16K33plus_Model1::displayChar(uint8_t digitPosition, cha
 	@returns Return code indicating success or an error (enumeration rdlib::Return_Codes_e).
 	@details Converts the ASCII character into the appropriate segment mapping for the display type (9-segment, 14-segment, or 16-segment).
 	         The decimal point is applied if applicable.
-	         The processed data is then sent to the display.
+	         The processed data is then staged in the display RAM shadow.
 */
 rdlib::Return_Codes_e HT16K33plus_Model1::displayMultiSegNum(uint8_t digitPosition, char character, DecimalPoint_e decimalOnPoint)
 {
-	uint16_t characterConverted;
+	if (_displayType == SegType7) return rdlib::GenericError; // this will never occur in normal user operation
+	uint16_t characterConverted = getCharSegments(character, decimalOnPoint);
+	_displayRAM.stage(digitPosition * 2, characterConverted & 0x00FF);
+	_displayRAM.stage(digitPosition * 2 + 1, (characterConverted & 0xFF00) >> 8);
+	return rdlib::Success;
+}
+
+/*!
+	@brief Gets the segment data of a character for the display type, from the font.
+	@param character The ASCII character.
+	@param decimalOnPoint Specifies whether the decimal point should be enabled (enumeration DecimalPoint_e).
+	@returns The segment data, as for stageRawData, 0 if the character is outside the font.
+*/
+uint16_t HT16K33plus_Model1::getCharSegments(char character, DecimalPoint_e decimalOnPoint) const
+{
+	if (character < _HT_ASCIIOffset || character >= _HT_ASCIIEnd) return 0;
+	uint16_t characterConverted = 0;
 	switch (_displayType)
 	{
-		case SegType7:
-			return rdlib::GenericError; // this will never occur in normal user operation
-		break; 
+		case SegType7:{
+			const uint8_t* font = SevenSegmentFont::pFontSevenSegptr();
+			characterConverted = font[character- _HT_ASCIIOffset];
+			if (decimalOnPoint ==  DecPointOn) characterConverted |= _HT_DEC_POINT_7_MASK;
+			}
+		break;
 		case SegType9:{
 			const uint16_t* fontNine = NineSegmentFont::pFontNineSegptr();
 			characterConverted = fontNine[character- _HT_ASCIIOffset];
@@ -361,13 +430,7 @@ rdlib::Return_Codes_e HT16K33plus_Model1::displayMultiSegNum(uint8_t digitPositi
 			}
 		break;
 	}
-	uint8_t txDataBuffer[3];
-	size_t bufferLength= sizeof(txDataBuffer);
-	txDataBuffer[0] = digitPosition * 2;
-	txDataBuffer[1] = characterConverted & 0x00FF;
-	txDataBuffer[2] = (characterConverted & 0xFF00) >> 8;
-	SendData(txDataBuffer, bufferLength);
-	return rdlib::Success;
+	return characterConverted;
 }
 
 /*!
@@ -375,16 +438,24 @@ rdlib::Return_Codes_e HT16K33plus_Model1::displayMultiSegNum(uint8_t digitPositi
 	@param digitPosition The position of the digit on the display (0-based index).
 	@param rawData The raw segment data to be displayed (bit-mapped for the display type).
 	@details This function allows direct control of the display segments by sending raw data.
-	         The rawData value is split into two bytes and transmitted to the display.
+	         The rawData value is split into two bytes and transmitted to the display, if changed.
+	@note To write several digits in one I2C write use stageRawData for each then commitFrame.
 */
 void HT16K33plus_Model1::displayRawData(uint8_t digitPosition, uint16_t rawData)
 {
-	uint8_t txDataBuffer[3];
-	size_t bufferLength = sizeof(txDataBuffer); 
-	txDataBuffer[0] = digitPosition * 2;
-	txDataBuffer[1] = rawData & 0x00FF;
-	txDataBuffer[2] = (rawData & 0xFF00) >> 8;
-	SendData(txDataBuffer, bufferLength);
+	stageRawData(digitPosition, rawData);
+	commitFrame();
+}
+
+/*!
+	@brief Stages raw segment data for a digit position, sent by the next commitFrame.
+	@param digitPosition The position of the digit on the display (0-based index).
+	@param rawData The raw segment data to be displayed (bit-mapped for the display type).
+*/
+void HT16K33plus_Model1::stageRawData(uint8_t digitPosition, uint16_t rawData)
+{
+	_displayRAM.stage(digitPosition * 2, rawData & 0x00FF);
+	_displayRAM.stage(digitPosition * 2 + 1, (rawData & 0xFF00) >> 8);
 }
 
 /*!
@@ -396,8 +467,9 @@ void HT16K33plus_Model1::ClearDigits(void)
 {
 	for(uint8_t i=0; i<=_numOfDigits; i++) 
 	{
-		displayChar(i, ' ', DecPointOff);
+		stageChar(i, ' ', DecPointOff);
 	}
+	commitFrame();
 }
 
 /*!
@@ -442,12 +514,13 @@ rdlib::Return_Codes_e HT16K33plus_Model1::displayText(const char *text, TextAlig
 	{
 		char character = *text++;
 		if (_displayType != SegType16 && *text == '.' && character != '.') {
-			displayChar(displayPos++, character, DecPointOn);
+			stageChar(displayPos++, character, DecPointOn);
 			text++;  // Skip the decimal point
 		} else {
-			displayChar(displayPos++, character, DecPointOff);
+			stageChar(displayPos++, character, DecPointOff);
 		}
 	}
+	commitFrame();
 	return rdlib::Success;
 }
 
@@ -473,12 +546,13 @@ rdlib::Return_Codes_e HT16K33plus_Model1::displayText(const char *text) {
 	while ((character = (*text++)) && pos < _numOfDigits)
 		{
 			if (_displayType != SegType16 && *text == '.' && character != '.') {
-				displayChar(pos++ ,character, DecPointOn);
+				stageChar(pos++ ,character, DecPointOn);
 				text++;
 			}else{
-				displayChar(pos++ ,character, DecPointOff);
+				stageChar(pos++ ,character, DecPointOff);
 			}
 		}
+	commitFrame();
 	return rdlib::Success;
 }
 
@@ -382,6 +382,20 @@ void ILI9341_TFT::invertDisplay(bool invert) {
 	}
 }
 
+/*!
+	@brief   Enable/Disable the Tearing Effect output line (TE pin)
+	@param   enable True to output V-Blank pulses on TE pin, False TE output off
+	@note    Used with frame_scheduler TearSyncGpioBegin to start flushes in V-Blank
+*/
+void ILI9341_TFT::tearingEffect(bool enable) {
+	if(enable) {
+		writeCommand(ILI9341_TEON);
+		writeData(0x00); // TELOM = 0, V-Blank information only
+	} else {
+		writeCommand(ILI9341_TEOFF);
+	}
+}
+
 /*!
 	@brief enable /disable display mode
 	@param enableDisplay true enable on, false disable
@@ -0,0 +1,312 @@
+/*!
+	@file     led_segment_marquee_RDL.cpp
+	@author   Gavin Lyons
+	@brief    Source file for scrolling text on the LED segment displays.
+*/
+
+#include "../include/led_segment_marquee_RDL.hpp"
+#include "../include/tm1638/TM1638plus_Model1_RDL.hpp"
+#include "../include/tm1638/TM1638plus_Model2_RDL.hpp"
+#include "../include/tm1637/TM1637plus_Model4_RDL.hpp"
+#include "../include/max7219/MAX7219_7SEG_RDL.hpp"
+#include "../include/ht16k33/HT16K33plus_Model1_RDL.hpp"
+
+/*!
+	@brief Constructor for a marquee on a TM1638 Model 1 or Model 3, 8 digits
+	@param display The module, displayBegin must have been called
+*/
+led_segment_marquee::led_segment_marquee(TM1638plus_Model1& display)
+	: led_segment_marquee(8,
+		[&display](char character, bool dot) -> uint16_t
+		{
+			return display.encodeCharacter(character) | (dot ? 0x80 : 0x00);
+		},
+		[&display](std::span<const uint16_t> window)
+		{
+			uint8_t segments[8];
+			for (size_t digit = 0; digit < window.size(); digit++)
+				segments[digit] = static_cast<uint8_t>(window[digit]);
+			display.setSegments(segments, static_cast<uint8_t>(window.size()), 0);
+		})
+{
+}
+
+/*!
+	@brief Constructor for a marquee on a TM1638 Model 2, 8 digits
+	@param display The module, displayBegin must have been called
+*/
+led_segment_marquee::led_segment_marquee(TM1638plus_Model2& display)
+	: led_segment_marquee(8,
+		[&display](char character, bool dot) -> uint16_t
+		{
+			return display.encodeCharacter(character) | (dot ? 0x80 : 0x00);
+		},
+		[&display](std::span<const uint16_t> window)
+		{
+			uint8_t segments[8];
+			for (size_t digit = 0; digit < window.size(); digit++)
+				segments[digit] = static_cast<uint8_t>(window[digit]);
+			display.ASCIItoSegment(segments);
+		})
+{
+}
+
+/*!
+	@brief Constructor for a marquee on a TM1637 Model 4
+	@param display The module, displayBegin must have been called
+	@note The dot of a character is the decimal point or colon, as wired on the module.
+*/
+led_segment_marquee::led_segment_marquee(TM1637plus_Model4& display)
+	: led_segment_marquee(display.getDisplaySize(),
+		[&display](char character, bool dot) -> uint16_t
+		{
+			return display.encodeCharacter(character) | (dot ? 0x80 : 0x00);
+		},
+		[&display](std::span<const uint16_t> window)
+		{
+			uint8_t segments[UINT8_MAX];
+			for (size_t digit = 0; digit < window.size(); digit++)
+				segments[digit] = static_cast<uint8_t>(window[digit]);
+			display.setSegments(segments, static_cast<uint8_t>(window.size()), 0);
+		})
+{
+}
+
+/*!
+	@brief Constructor for a marquee across a cascade of MAX7219 displays
+	@param display The displays, InitDisplay must have been called in no decode mode
+	@details The text runs across every display, display 1 on the left,
+		using the number of digits set by InitDisplay on each.
+*/
+led_segment_marquee::led_segment_marquee(MAX7219_SS_RPI& display)
+	: led_segment_marquee(static_cast<uint16_t>(display.GetNumberOfDisplays() * display.GetNumberOfDigits()),
+		[&display](char character, bool dot) -> uint16_t
+		{
+			return display.GetCharSegments(character, dot ? MAX7219_SS_RPI::DecPointOn : MAX7219_SS_RPI::DecPointOff);
+		},
+		[&display, frame = std::vector<uint8_t>(display.GetNumberOfDisplays() * MAX7219_SS_RPI::DigitsPerDisplay, 0),
+			digits = display.GetNumberOfDigits()](std::span<const uint16_t> window) mutable
+		{
+			// window digit 0 is the leftmost digit of display 1, the highest digit register
+			for (size_t index = 0; index < window.size(); index++)
+			{
+				size_t displayIndex = index / digits;
+				size_t digit = digits - 1 - (index % digits);
+				frame[displayIndex * MAX7219_SS_RPI::DigitsPerDisplay + digit] = static_cast<uint8_t>(window[index]);
+			}
+			display.DisplayFrame(frame);
+		})
+{
+}
+
+/*!
+	@brief Constructor for a marquee on a HT16K33 display
+	@param display The display, DisplayInit must have been called, sets the font used
+*/
+led_segment_marquee::led_segment_marquee(HT16K33plus_Model1& display)
+	: led_segment_marquee(display.getNumOfDigits(),
+		[&display](char character, bool dot) -> uint16_t
+		{
+			return display.getCharSegments(character, dot ? HT16K33plus_Model1::DecPointOn : HT16K33plus_Model1::DecPointOff);
+		},
+		[&display](std::span<const uint16_t> window)
+		{
+			for (size_t digit = 0; digit < window.size(); digit++)
+				display.stageRawData(static_cast<uint8_t>(digit), window[digit]);
+			display.commitFrame();
+		})
+{
+}
+
+/*!
+	@brief Constructor for a marquee on any display
+	@param digits number of digits on the display, 1 or more, wider than 8 bits for long MAX7219 cascades
+	@param encode function returning the segment code of a character, with or without the decimal point
+	@param frame function writing a window of digits segment codes to the display, leftmost first
+*/
+led_segment_marquee::led_segment_marquee(uint16_t digits, EncodeFunc_t encode, FrameFunc_t frame)
+	: _digits(digits > 0 ? digits : 1), _encode(std::move(encode)), _frame(std::move(frame))
+{
+}
+
+/*!
+	@brief Destructor for class led_segment_marquee, stops the step thread
+*/
+led_segment_marquee::~led_segment_marquee()
+{
+	stop();
+}
+
+/*!
+	@brief Set the text to scroll, the next step starts it from the right
+	@param text the text, a '.' after a character turns on its decimal point as displayText does
+	@return
+		-# rdlib::Success
+		-# rdlib::CharArrayNullptr
+		-# rdlib::CharFontASCIIRange a character outside the font, space to 'z', text not changed
+	@details Every character is encoded here, once, steps only copy codes.
+		Can be called while running.
+*/
+rdlib::Return_Codes_e led_segment_marquee::setText(const char *text)
+{
+	if (text == nullptr)
+	{
+		fprintf(stderr, "Error: led_segment_marquee setText: String is a null pointer.\n");
+		return rdlib::CharArrayNullptr;
+	}
+	std::vector<uint16_t> strip(_digits, _encode(' ', false));
+	for (const char *character = text; *character != '\0'; character++)
+	{
+		if (*character < ASCIIOffset || *character >= ASCIIEnd)
+		{
+			fprintf(stderr, "Error: led_segment_marquee setText: character outside font range : %d\n", *character);
+			return rdlib::CharFontASCIIRange;
+		}
+		bool dot = (*(character + 1) == '.' && *character != '.');
+		strip.push_back(_encode(*character, dot));
+		if (dot) character++;
+	}
+	strip.insert(strip.end(), _digits, _encode(' ', false));
+
+	std::lock_guard<std::mutex> lock(_mutex);
+	_strip.swap(strip);
+	_position = 1;
+	return rdlib::Success;
+}
+
+/*!
+	@brief Set the time between steps
+	@param periodMs 10 to 10000 mS, default 250
+	@return rdlib::Success, rdlib::GenericError out of range
+	@note Takes effect from the next step.
+*/
+rdlib::Return_Codes_e led_segment_marquee::setStepPeriod(uint16_t periodMs)
+{
+	if (periodMs < 10 || periodMs > 10000)
+	{
+		fprintf(stderr, "Error: led_segment_marquee setStepPeriod: period out of range 10-10000 : %u\n", periodMs);
+		return rdlib::GenericError;
+	}
+	_stepPeriodMs.store(periodMs);
+	return rdlib::Success;
+}
+
+/*!
+	@brief Get the time between steps
+	@return period in mS
+*/
+uint16_t led_segment_marquee::getStepPeriod(void) const {return _stepPeriodMs.load();}
+
+/*!
+	@brief Set if the text starts again after it has left the display
+	@param loop true to repeat (default), false to stop the step thread when the display is blank
+*/
+void led_segment_marquee::setLoop(bool loop)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_loop = loop;
+}
+
+/*!
+	@brief Get the number of digits on the display
+	@return digits, the width of a step
+*/
+uint16_t led_segment_marquee::getDigits(void) const {return _digits;}
+
+/*!
+	@brief Start the step thread
+	@return
+		-# rdlib::Success
+		-# rdlib::GenericError already running
+	@note From now until stop() the display must not be written by other code.
+*/
+rdlib::Return_Codes_e led_segment_marquee::start(void)
+{
+	if (_running.exchange(true))
+	{
+		fprintf(stderr, "Error: led_segment_marquee start: Step thread already running\n");
+		return rdlib::GenericError;
+	}
+	if (_thread.joinable()) _thread.join(); // ended by itself at the end of the text
+	_thread = std::thread(&led_segment_marquee::stepThread, this);
+	return rdlib::Success;
+}
+
+/*!
+	@brief Stop the step thread, the display keeps the last step
+*/
+void led_segment_marquee::stop(void)
+{
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		_running.store(false);
+	}
+	_stopCond.notify_one();
+	if (_thread.joinable()) _thread.join();
+}
+
+/*!
+	@brief Is the step thread running
+	@return true if running, false once stopped or the text has ended with loop off
+*/
+bool led_segment_marquee::isRunning(void) const {return _running.load();}
+
+/*!
+	@brief Show the next step, for callers driving the marquee without the step thread
+	@return false if there is no text, or the text has ended with loop off
+*/
+bool led_segment_marquee::step(void)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	return advance();
+}
+
+/*!
+	@brief Start the text from the right again on the next step
+*/
+void led_segment_marquee::rewind(void)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_position = 1;
+}
+
+/// @cond
+
+// Write the window at _position and move on, _mutex held.
+// Window 0, all blank, is shown only at the end of a pass, it equals the last window.
+bool led_segment_marquee::advance(void)
+{
+	if (_strip.size() < 2U * _digits + 1U) return false;
+	const size_t last = _strip.size() - _digits;
+	if (_position > last)
+	{
+		if (!_loop) return false;
+		_position = 1;
+	}
+	_frame(std::span<const uint16_t>(_strip.data() + _position, _digits));
+	_position++;
+	return true;
+}
+
+// Step thread, one step per period on the steady clock, a late step does not bring the next forward
+void led_segment_marquee::stepThread(void)
+{
+	auto nextStep = StepClock_t::now();
+	std::unique_lock<std::mutex> lock(_mutex);
+	while (_running.load())
+	{
+		if (!advance())
+		{
+			_running.store(false);
+			break;
+		}
+		const auto now = StepClock_t::now();
+		nextStep += std::chrono::milliseconds(_stepPeriodMs.load());
+		if (nextStep < now) nextStep = now + std::chrono::milliseconds(_stepPeriodMs.load());
+		_stopCond.wait_until(lock, nextStep, [this]{return !_running.load();});
+	}
+}
+
+/// @endcond
+
+// **************** EOF *****************
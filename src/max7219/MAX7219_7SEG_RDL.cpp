@@ -25,6 +25,7 @@ MAX7219_SS_RPI::MAX7219_SS_RPI(uint8_t clock, uint8_t chipSelect , uint8_t data,
 	_HardwareSPI = false;
 	_NoDisplays = totalDisplays;
 	_DeviceNumGpioChip = gpioDev;
+	_digitShadow.resize(static_cast<size_t>(_NoDisplays) * DigitsPerDisplay);
 }
 
 /*!
@@ -44,6 +45,7 @@ MAX7219_SS_RPI::MAX7219_SS_RPI(int device, int channel, int speed, int flags, ui
 	_spiFlags = flags;
 	_NoDisplays = totalDisplays;
 	_HardwareSPI = true;
+	_digitShadow.resize(static_cast<size_t>(_NoDisplays) * DigitsPerDisplay);
 }
 
 /*!
@@ -62,30 +64,22 @@ rdlib::Return_Codes_e MAX7219_SS_RPI::DisplayEndOperations(void)
 	{
 		// 1A Free GPIO 3 lines 
 		int GpioStrobeErrorstatus = 0;
-		int GpioClockErrorstatus = 0;
-		int GpioDataErrorstatus = 0;
+		int GpioBusErrorstatus = 0;
 
 		Display_CS_SetLow;
-		Display_SCLK_SetLow;
-		Display_SDATA_SetLow;
+		_bus.setLines(false, false);
 
 		GpioStrobeErrorstatus = Display_GPIO_FREE_CS;
-		GpioClockErrorstatus =  Display_GPIO_FREE_CLK;
-		GpioDataErrorstatus =   Display_GPIO_FREE_SDATA;
+		GpioBusErrorstatus =  _bus.release();
 	
 		if (GpioStrobeErrorstatus < 0 )
 		{
 			fprintf(stderr,"Error: Can't Free CS GPIO (%s)\n", lguErrorText(GpioStrobeErrorstatus));
 			ErrorFlag = 2;
 		}
-		if (GpioClockErrorstatus < 0 )
+		if (GpioBusErrorstatus < 0 )
 		{
-			fprintf(stderr,"Error: Can't Free CLK GPIO (%s)\n", lguErrorText(GpioClockErrorstatus));
-			ErrorFlag = 2;
-		}
-		if (GpioDataErrorstatus < 0 )
-		{
-			fprintf(stderr, "Error: Can't free DATA GPIO (%s)\n", lguErrorText(GpioDataErrorstatus));
+			fprintf(stderr,"Error: Can't Free CLK and DATA GPIO (%s)\n", lguErrorText(GpioBusErrorstatus));
 			ErrorFlag = 2;
 		}
 		 // 2 close gpio chip device
@@ -118,6 +112,16 @@ rdlib::Return_Codes_e MAX7219_SS_RPI::DisplayEndOperations(void)
 	return rdlib::Success;
 }
 
+/*!
+	@brief Forget the shadow copy of the digit registers of all displays
+	@details Digit writes are skipped when the data is already in the digit register.
+		Call this if the displays were power cycled, the next write of each digit is sent.
+*/
+void MAX7219_SS_RPI::InvalidateShadow(void)
+{
+	_digitShadow.invalidate();
+}
+
 /*!
 	@brief get value of _HardwareSPI , true hardware SPI on , false off.
 	@return _HardwareSPI , true hardware SPI on , false off.
@@ -144,8 +148,7 @@ rdlib::Return_Codes_e MAX7219_SS_RPI::InitDisplay(ScanLimit_e numDigits, DecodeM
 		if (_HardwareSPI == false)
 		{
 			int GpioStrobeErrorstatus = 0;
-			int GpioClockErrorstatus = 0;
-			int GpioDataErrorstatus = 0;
+			int GpioBusErrorstatus = 0;
 
 			_GpioHandle = Display_OPEN_GPIO_CHIP; // open /dev/gpiochipX
 			if ( _GpioHandle < 0)	// open error
@@ -156,22 +159,16 @@ rdlib::Return_Codes_e MAX7219_SS_RPI::InitDisplay(ScanLimit_e numDigits, DecodeM
 
 			// Clain GPIO as outputs
 			GpioStrobeErrorstatus = Display_CS_SetDigitalOutput;
-			GpioClockErrorstatus =  Display_SCLK_SetDigitalOutput;
-			GpioDataErrorstatus =   Display_SDATA_SetDigitalOutput ;
+			GpioBusErrorstatus =  _bus.claim(_GpioHandle, _Display_SCLK, _Display_SDATA);
 
 			if (GpioStrobeErrorstatus < 0 )
 			{
 				fprintf(stderr,"Error : Can't claim CS GPIO for output (%s)\n", lguErrorText(GpioStrobeErrorstatus));
 				return rdlib::GpioPinClaim;
 			}
-			if (GpioClockErrorstatus < 0 )
+			if (GpioBusErrorstatus < 0 )
 			{
-				fprintf(stderr,"Error : Can't claim CLK GPIO for output (%s)\n", lguErrorText(GpioClockErrorstatus));
-				return rdlib::GpioPinClaim;
-			}
-			if (GpioDataErrorstatus < 0 )
-			{
-				fprintf(stderr, "Error : Can't claim DATA GPIO for output (%s)\n", lguErrorText(GpioDataErrorstatus));
+				fprintf(stderr,"Error : Can't claim CLK and DATA GPIO for output (%s)\n", lguErrorText(GpioBusErrorstatus));
 				return rdlib::GpioPinClaim;
 			}
 			Display_CS_SetHigh;
@@ -189,6 +186,9 @@ rdlib::Return_Codes_e MAX7219_SS_RPI::InitDisplay(ScanLimit_e numDigits, DecodeM
 
 	_NoDigits = numDigits+1;
 	CurrentDecodeMode = decodeMode;
+	// digit registers are undefined at power on, ClearDisplay below writes them all
+	if (_CurrentDisplayNumber <= _NoDisplays)
+		_digitShadow.invalidate((_CurrentDisplayNumber - 1) * DigitsPerDisplay, DigitsPerDisplay);
 
 	SetScanLimit(numDigits);
 	SetDecodeMode(decodeMode);
@@ -459,6 +459,18 @@ uint16_t  MAX7219_SS_RPI::GetCommDelay(void) {return _CommDelay;}
 */
 uint8_t MAX7219_SS_RPI::GetCurrentDisplayNumber(void){return _CurrentDisplayNumber; }
 
+/*!
+	@brief Get the number of displays in the cascade
+	@return number of displays, as passed to the constructor
+*/
+uint8_t MAX7219_SS_RPI::GetNumberOfDisplays(void){return _NoDisplays; }
+
+/*!
+	@brief Get the number of digits of each display
+	@return number of digits, the scan limit set by InitDisplay
+*/
+uint8_t MAX7219_SS_RPI::GetNumberOfDigits(void){return _NoDigits; }
+
 /*!
 	@brief Set the Current Display Number
 	@param DisplayNum Set the Current Display Number
@@ -534,24 +546,74 @@ void MAX7219_SS_RPI::DisplayDecNumNibble(uint16_t  numberUpper, uint16_t numberL
 
 
 
+/*!
+	@brief Write the digit registers of every display in the cascade
+	@param frame digit register data, DigitsPerDisplay bytes per display.
+		frame[((displayNum-1) * 8) + digit] is digit 7-0 (7 = LHS 0 = RHS) of display displayNum,
+		as SetSegment or DisplayBCDChar in BCD mode.
+	@return a rdlib::Return_Codes_e  code
+		-# rdlib::Success
+		-# rdlib::BufferEmpty frame is empty
+		-# rdlib::BufferSize frame is not number of displays * 8 bytes
+	@details Each digit register is written to all displays in one transaction of the chain,
+		so a full update is one transaction per digit whatever the number of displays,
+		instead of one per digit of each display with the other displays sent NOPs.
+		Digits beyond the scan limit set by InitDisplay are not written,
+		nor are digits whose register already holds the data on every display.
+*/
+rdlib::Return_Codes_e MAX7219_SS_RPI::DisplayFrame(std::span<const uint8_t> frame)
+{
+	if (frame.empty())
+	{
+		fprintf(stderr, "Error: DisplayFrame: frame is empty\n");
+		return rdlib::BufferEmpty;
+	}
+	if (frame.size() != static_cast<size_t>(_NoDisplays) * DigitsPerDisplay)
+	{
+		fprintf(stderr, "Error: DisplayFrame: frame must be %u bytes, 8 per display\n", _NoDisplays * DigitsPerDisplay);
+		return rdlib::BufferSize;
+	}
+	uint8_t digitData[UINT8_MAX];
+	for (uint8_t digit = 0; digit < _NoDigits; digit++)
+	{
+		bool changed = false;
+		for (uint8_t display = 0; display < _NoDisplays; display++)
+		{
+			size_t address = (display * DigitsPerDisplay) + digit;
+			digitData[display] = frame[address];
+			_digitShadow.stage(address, frame[address]);
+			if (_digitShadow.isChanged(address)) changed = true;
+		}
+		if (!changed) continue;
+		bool success = WriteChain(digit + 1, std::span<const uint8_t>(digitData, _NoDisplays));
+		for (uint8_t display = 0; display < _NoDisplays; display++)
+			_digitShadow.markSent((display * DigitsPerDisplay) + digit, 1, success);
+	}
+	return rdlib::Success;
+}
+
+/*!
+	@brief Get the segment data of an ASCII character, for building a DisplayFrame frame
+	@param character The ASCII character to look up
+	@param decimalPoint Is the decimal point(dp) to be set or not.
+	@return segment data dp-abcdefg as DisplayChar writes, 0 if outside font range
+*/
+uint8_t MAX7219_SS_RPI::GetCharSegments(uint8_t character, DecimalPoint_e decimalPoint)
+{
+	return ASCIIFetch(character, decimalPoint);
+}
+
 // Private methods
 
  /*!
 	@brief Shifts out a uint8_t of data on to the MAX7219 SPI-like bus
 	@param value The uint8_t of data to shift out
-	@note _CommDelay microsecond delay may have to be adjusted depending on processor
+	@note _CommDelay microsecond delay may have to be adjusted depending on processor,
+		delays up to bitbang_delay::SpinLimitMicroSec busy-wait.
 */
 void MAX7219_SS_RPI::HighFreqshiftOut(uint8_t value)
 {
-
-	for (uint8_t bit = 0; bit < 8; bit++)
-	{
-		!!(value & (1 << (7 - bit))) ? Display_SDATA_SetHigh: Display_SDATA_SetLow; // MSBFIRST
-		Display_SCLK_SetHigh;
-		delayMicroSecRDL(_CommDelay);
-		Display_SCLK_SetLow;
-		delayMicroSecRDL(_CommDelay);
-	}
+	_bus.shiftOut(value, bitbang_bus::BitOrder_e::MSBFirst, _CommDelay);
 }
 
 
@@ -588,9 +650,19 @@ uint8_t MAX7219_SS_RPI::ASCIIFetch(uint8_t character, DecimalPoint_e decimalPoin
 	@brief Write to the MAX7219 display register
 	@param RegisterCode the register to write to
 	@param data The data byte to send to register
+	@note A digit register write is skipped if the register already holds the data.
 */
 void MAX7219_SS_RPI::WriteDisplay( uint8_t RegisterCode, uint8_t data)
 {
+	size_t shadowAddress = 0;
+	bool shadowed = (RegisterCode >= 1 && RegisterCode <= DigitsPerDisplay && _CurrentDisplayNumber <= _NoDisplays);
+	if (shadowed)
+	{
+		shadowAddress = ((_CurrentDisplayNumber - 1) * DigitsPerDisplay) + (RegisterCode - 1);
+		_digitShadow.stage(shadowAddress, data);
+		if (!_digitShadow.isChanged(shadowAddress)) return;
+	}
+	bool success = true;
 
 	if (_HardwareSPI == false)
 	{
@@ -625,8 +697,48 @@ void MAX7219_SS_RPI::WriteDisplay( uint8_t RegisterCode, uint8_t data)
 		if (spiErrorStatus <0)
 		{
 			fprintf(stderr, "Error : Failure to Write  SPI :(%s)\n", lguErrorText(spiErrorStatus));
+			success = false;
+		}
+	}
+	if (shadowed) _digitShadow.markSent(shadowAddress, 1, success);
+}
+
+/*!
+	@brief Write a register of every display in the cascade in one transaction
+	@param RegisterCode the register to write to
+	@param data The data byte for each display, data[0] is display 1
+	@return false if the SPI write failed
+*/
+bool MAX7219_SS_RPI::WriteChain(uint8_t RegisterCode, std::span<const uint8_t> data)
+{
+	if (_HardwareSPI == false)
+	{
+		Display_CS_SetLow;
+		// last display in chain first
+		for (int16_t i = _NoDisplays - 1; i >= 0; i--)
+		{
+			HighFreqshiftOut(RegisterCode);
+			HighFreqshiftOut(data[i]);
+		}
+		Display_CS_SetHigh;
+	}else
+	{
+		char TransmitBuffer[UINT8_MAX * 2];
+		for (uint8_t i = 0; i < _NoDisplays; i++)
+		{
+			uint8_t displayIndex = _NoDisplays - 1 - i;
+			TransmitBuffer[displayIndex * 2]     = RegisterCode;
+			TransmitBuffer[displayIndex * 2 + 1] = data[i];
+		}
+		int spiErrorStatus = 0;
+		spiErrorStatus = Display_SPI_WRITE(_spiHandle, static_cast<const char*>(TransmitBuffer), _NoDisplays * 2);
+		if (spiErrorStatus <0)
+		{
+			fprintf(stderr, "Error : Failure to Write  SPI :(%s)\n", lguErrorText(spiErrorStatus));
+			return false;
 		}
 	}
+	return true;
 }
 
 /*!
@@ -223,6 +223,7 @@ void  NOKIA_5110_RPI::LCDInit(void)
 */
 rdlib::Return_Codes_e  NOKIA_5110_RPI::LCDSPIoff(void)
 {
+	commitAsyncEnd();
 	uint8_t ErrorFlag = 0; // Becomes >0 in event of error
 	
 	// 1. free rst & DC GPIO lines
@@ -297,6 +298,7 @@ rdlib::Return_Codes_e  NOKIA_5110_RPI::LCDSPIoff(void)
 */
 void NOKIA_5110_RPI::LCDPowerDown(void)
 {
+	commitAsyncEnd();
 	Display_DC_SetLow;
 	Display_RST_SetLow;
 
@@ -314,6 +316,7 @@ void NOKIA_5110_RPI::LCDPowerDown(void)
 */
 void NOKIA_5110_RPI::LCDWriteData(uint8_t dataByte)
 {
+	auto busLock = SPIBusLock();
 	if (isHardwareSPI() == false)
 	{
 		uint8_t bit_n;
@@ -340,11 +343,35 @@ void NOKIA_5110_RPI::LCDWriteData(uint8_t dataByte)
 		}
 }
 
+/*!
+	@brief  Writes data bytes to the PCD8544
+	@param data bytes will be sent as command or data depending on status of DC line
+	@details Hardware SPI sends them in one transfer, not one per byte.
+*/
+void NOKIA_5110_RPI::LCDWriteData(std::span<const uint8_t> data)
+{
+	auto busLock = SPIBusLock();
+	if (isHardwareSPI() == false)
+	{
+		for (uint8_t dataByte : data)
+			LCDWriteData(dataByte);
+	}else{
+			if (data.empty()) return;
+			int spiErrorStatus = 0;
+			spiErrorStatus = Display_SPI_WRITE( _spiHandle, reinterpret_cast<const char*>(data.data()), data.size());
+			if (spiErrorStatus <0) 
+			{
+				fprintf(stderr, "Error : Failure to Write  SPI :(%s)\n", lguErrorText(spiErrorStatus));
+			}
+		}
+}
+
 /*!
 	@brief  Writes a command byte to the PCD8544
 	@param command The command byte to send
 */
 void NOKIA_5110_RPI::LCDWriteCommand(uint8_t command) {
+	auto busLock = SPIBusLock();
 	Display_DC_SetLow;
 	if (isHardwareSPI() == false)Display_CS_SetLow;
 	LCDWriteData(command);
@@ -362,42 +389,6 @@ void NOKIA_5110_RPI::LCDSetContrast(uint8_t contrast) {
 	LCDWriteCommand(LCD_FUNCTIONSET);
 }
 
-/*!
-	@brief Set a single pixel in the buffer
-	@param x  x coordinate
-	@param y  y coordinate
-	@param color Color of pixel
-*/
-void NOKIA_5110_RPI::drawPixel(int16_t x, int16_t y, uint8_t color) {
-
-	if ((x < 0) || (x >= _width) || (y < 0) || (y >= _height)) {
-	return;
-	}
-	
-	uint8_t rotation = getRotation();
-	switch(rotation) 
-	{
-		case 1:
-			std::swap(x, y);
-			y =  HEIGHT - 1 - y;
-			break;
-		case 2:
-			x = WIDTH - 1 - x;
-			y = HEIGHT - 1 - y;
-			break;
-		case 3:
-			std::swap(x, y);
-			x = WIDTH - 1 - x;
-	}
-	uint16_t tc = (_LCD_WIDTH * (y / 8)) + x;
-	switch (color)
-	{
-		case WHITE:   this->_LCDbuffer[tc] &= ~(1 << (y & 7)); break;
-		case BLACK:   this->_LCDbuffer[tc] |= (1 << (y & 7));  break;
-		case INVERSE: this->_LCDbuffer[tc] ^= (1 << (y & 7));  break;
-	}
-}
-
 /*!
 	@brief Writes the buffer (with pattern) to the LCD
 	@param Pattern The pattern to send 0x00 to 0xFF, by default 0x00
@@ -405,15 +396,15 @@ void NOKIA_5110_RPI::drawPixel(int16_t x, int16_t y, uint8_t color) {
 */
 void NOKIA_5110_RPI::LCDfillScreen(uint8_t Pattern)
 {
-	uint16_t i;
+	auto busLock = SPIBusLock();
+	uint8_t fillData[256];
+	std::fill_n(fillData, sizeof(fillData), Pattern);
 	LCDWriteCommand(LCD_SETYADDR); // set y = 0
 	LCDWriteCommand(LCD_SETXADDR); // set x = 0
 	Display_DC_SetHigh;			   // Data send
 	if (isHardwareSPI() == false) Display_CS_SetLow;
-	for (i = 0; i < _LCD_Display_size; i++)
-	{
-		LCDWriteData(Pattern);
-	}
+	for (uint16_t sent = 0; sent < _LCD_Display_size; sent += sizeof(fillData))
+		LCDWriteData(std::span<const uint8_t>(fillData, std::min<size_t>(sizeof(fillData), _LCD_Display_size - sent)));
 	if (isHardwareSPI() == false) Display_CS_SetHigh;
 }
 
@@ -507,6 +498,7 @@ rdlib::Return_Codes_e NOKIA_5110_RPI::LCDSetBufferPtr(std::span<uint8_t> buffer)
 		printf("NOKIA_5110::LCDSetBufferPtr Error 3: Problem assigning buffer, received empty buffer\r\n");
 		return rdlib::BufferEmpty;
 	}
+	setPageBuffer(_LCDbuffer, _LCD_WIDTH, page_buffer_1bpp::RotationMap_e::Swapped);
 	return rdlib::Success;
 }
 
@@ -516,6 +508,7 @@ rdlib::Return_Codes_e NOKIA_5110_RPI::LCDSetBufferPtr(std::span<uint8_t> buffer)
 	@return
 		-# Success
 		-# BufferEmpty if buffer is empty object
+	@note Blocks until sent, see commitAsync to send in the background.
 */
 rdlib::Return_Codes_e NOKIA_5110_RPI::LCDupdate()
 {
@@ -524,7 +517,7 @@ rdlib::Return_Codes_e NOKIA_5110_RPI::LCDupdate()
 		printf("NOKIA_5110 ::LCDupdate Error Buffer is empty, cannot update screen\r\n");
 		return rdlib::BufferEmpty;
 	}
-	LCDBuffer(_LCDbuffer);
+	updateFrame(_LCDbuffer);
 	return rdlib::Success;
 }
 
@@ -549,21 +542,23 @@ rdlib::Return_Codes_e  NOKIA_5110_RPI::LCDclearBuffer(uint8_t pattern)
 }
 
 /*!
-	 @brief Draw an  array  to the screen
-	 @param data span to the buffer array
-	 @note Called by LCDupdate internally to write buffer to screen
+	 @brief Sends a frame to the screen, used by LCDupdate and commitAsync
+	 @param frame screen buffer or a committed copy of it
+	 @param dirty not used, the whole screen is sent in one hardware SPI transfer
+	 @return rdlib::Success
 */
-void NOKIA_5110_RPI::LCDBuffer(std::span<uint8_t> data)
+rdlib::Return_Codes_e NOKIA_5110_RPI::sendFrame(std::span<const uint8_t> frame,
+		std::span<const page_buffer_1bpp::DirtyRange_t> dirty)
 {
+	(void)dirty;
+	auto busLock = SPIBusLock();
 	LCDWriteCommand(LCD_SETYADDR); // set y = 0
 	LCDWriteCommand(LCD_SETXADDR); // set x = 0
 	Display_DC_SetHigh;			   // Data send
 	if (isHardwareSPI() == false) Display_CS_SetLow;
-	for (uint16_t i = 0; i < _LCD_Display_size; i++)
-	{
-		LCDWriteData(data[i]);
-	}
+	LCDWriteData(frame.first(std::min<size_t>(frame.size(), _LCD_Display_size)));
 	if (isHardwareSPI() == false)Display_CS_SetHigh;
+	return rdlib::Success;
 }
 
 /* ------------- EOF ------------------ */
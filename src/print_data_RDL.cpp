@@ -129,13 +129,9 @@ size_t Print::print(long n, int base)
 		return write(n);
 	} else if (base == 10)
 	{
-		if (n < 0)
-		{
-			int t = print('-');
-			n = -n;
-			return printNumber(n, 10) + t;
-		}
-		return printNumber(n, 10);
+		char buf[1 + 3 * sizeof(long)]; // sign + decimal digits
+		char *end = std::to_chars(buf, buf + sizeof(buf), n).ptr;
+		return write(buf, end - buf);
 	} else
 	{
 		return printNumber(n, base);
@@ -296,75 +292,82 @@ size_t Print::println(const std::string &s) {
 	@brief Used internally to parse and print number
 	@param n Number to parse
 	@param base to print to Binary hexadecimal etc
-	@return passes the formatted string to write
+	@return passes the formatted characters to write in one call
  */
 size_t Print::printNumber(unsigned long n, uint8_t base)
 {
-	char buf[8 * sizeof(long) + 1]; // Assumes 8-bit chars plus zero byte.
-	char *str = &buf[sizeof(buf) - 1];
+	char buf[8 * sizeof(long)]; // Assumes 8-bit chars, base 2 worst case
 
-	*str = '\0';
+	// prevent crash if called with base == 1, to_chars supports bases 2-36
+	if (base < 2 || base > 36) base = 10;
 
-	// prevent crash if called with base == 1
-	if (base < 2) base = 10;
-
-	do {
-	char c = n % base;
-	n /= base;
-
-	*--str = c < 10 ? c + '0' : c + 'A' - 10;
-	} while(n);
-
-	return write(str);
+	char *end = std::to_chars(buf, buf + sizeof(buf), n, base).ptr;
+	if (base > 10) toUpperDigits(buf, end);
+	return write(buf, end - buf);
 }
 
 /*!
 	@brief Used internally to parse float
 	@param number The floating point number
 	@param digits Number of precision digits to print
-	@return total number of characters printed 
+	@return total number of characters printed
+	@details Formats into a stack buffer and passes it to write in one call
  */
 size_t Print::printFloat(double number, uint8_t digits)
 {
-	size_t n = 0;
-
 	if (std::isnan(number)) return print("nan");
 	if (std::isinf(number)) return print("inf");
 	if (number > 4294967040.0) return print ("ovf");  // constant determined empirically
 	if (number <-4294967040.0) return print ("ovf");  // constant determined empirically
 
+	// sign + 10 digit integer part + point + up to 255 digits
+	char buf[1 + 10 + 1 + 255];
+	char *pos = buf;
+
 	// Handle negative numbers
 	if (number < 0.0)
 	{
-	 n += print('-');
-	 number = -number;
+		*pos++ = '-';
+		number = -number;
 	}
 
 	// Round correctly so that print(1.999, 2) prints as "2.00"
 	double rounding = 0.5;
 	for (uint8_t i=0; i<digits; ++i)
-	rounding /= 10.0;
+		rounding /= 10.0;
 
 	number += rounding;
 
-	// Extract the integer part of the number and print it
+	// Extract the integer part of the number
 	unsigned long int_part = (unsigned long)number;
 	double remainder = number - (double)int_part;
-	n += print(int_part);
+	pos = std::to_chars(pos, buf + sizeof(buf), int_part).ptr;
 
-	// Print the decimal point, but only if there are digits beyond
-	if (digits > 0) {
-	n += print('.');
-	}
+	// The decimal point, but only if there are digits beyond
+	if (digits > 0)
+		*pos++ = '.';
 
 	// Extract digits from the remainder one at a time
 	while (digits-- > 0)
 	{
-	remainder *= 10.0;
-	unsigned int toPrint = (unsigned int)(remainder);
-	n += print(toPrint);
-	remainder -= toPrint;
+		remainder *= 10.0;
+		unsigned int toPrint = (unsigned int)(remainder);
+		*pos++ = static_cast<char>('0' + toPrint);
+		remainder -= toPrint;
 	}
 
-	return n;
+	return write(buf, pos - buf);
+}
+
+/*!
+	@brief Used internally to convert to_chars lower case digits to upper case, as the HEX output
+	@param first start of the digits
+	@param last one past the end of the digits
+ */
+void Print::toUpperDigits(char *first, char *last)
+{
+	for (; first != last; ++first)
+	{
+		if (*first >= 'a' && *first <= 'z') *first = static_cast<char>(*first - 'a' + 'A');
+	}
 }
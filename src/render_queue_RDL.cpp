@@ -0,0 +1,419 @@
+/*!
+	@file     render_queue_RDL.cpp
+	@author   Gavin Lyons
+	@brief    Source file for the asynchronous render queue of 16 bit color displays.
+*/
+
+#include "../include/render_queue_RDL.hpp"
+
+/*!
+	@brief Constructor for class render_queue
+	@param display The display the queued commands are drawn on
+	@param capacity Number of commands the ring holds, rounded up to a power of 2, minimum 2
+	@param policy What a producer does when the ring is full
+*/
+render_queue::render_queue(color16_graphics& display, size_t capacity, Backpressure_e policy)
+	: _display(display), _policy(policy)
+{
+	size_t size = 2;
+	while (size < capacity) size <<= 1;
+	_cells = std::make_unique<Cell_t[]>(size);
+	for (size_t i = 0; i < size; i++)
+		_cells[i].sequence.store(i, std::memory_order_relaxed);
+	_mask = size - 1;
+}
+
+/*!
+	@brief Destructor for class render_queue, stops the display thread
+*/
+render_queue::~render_queue()
+{
+	stop();
+}
+
+/*!
+	@brief Start the display thread
+	@return
+		-# rdlib::Success
+		-# rdlib::GenericError already running
+*/
+rdlib::Return_Codes_e render_queue::start(void)
+{
+	if (_running.exchange(true))
+	{
+		fprintf(stderr, "Error: render_queue start: Display thread already running\n");
+		return rdlib::GenericError;
+	}
+	_thread = std::thread(&render_queue::displayThread, this);
+	return rdlib::Success;
+}
+
+/*!
+	@brief Stop the display thread after it has run all queued commands
+*/
+void render_queue::stop(void)
+{
+	if (!_running.exchange(false)) return;
+	_wakeCounter.fetch_add(1, std::memory_order_release);
+	_wakeCounter.notify_one();
+	if (_thread.joinable()) _thread.join();
+}
+
+/*!
+	@brief Is the display thread running
+	@return true if running
+*/
+bool render_queue::isRunning(void) const {return _running.load();}
+
+/*!
+	@brief Queue a pixel
+	@param x X coordinate
+	@param y Y coordinate
+	@param color 565 16-bit color
+	@return rdlib::Success, or rdlib::GenericError if display thread is not running
+*/
+rdlib::Return_Codes_e render_queue::drawPixel(uint16_t x, uint16_t y, uint16_t color)
+{
+	RenderCommand_t cmd{};
+	cmd.op = RenderOp_e::Pixel;
+	cmd.a = x; cmd.b = y; cmd.color = color;
+	return enqueue(cmd);
+}
+
+/*!
+	@brief Queue a line
+	@param x0 start X coordinate
+	@param y0 start Y coordinate
+	@param x1 end X coordinate
+	@param y1 end Y coordinate
+	@param color 565 16-bit color
+	@return rdlib::Success, or rdlib::GenericError if display thread is not running
+*/
+rdlib::Return_Codes_e render_queue::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+	RenderCommand_t cmd{};
+	cmd.op = RenderOp_e::Line;
+	cmd.a = x0; cmd.b = y0; cmd.c = x1; cmd.d = y1; cmd.color = color;
+	return enqueue(cmd);
+}
+
+/*!
+	@brief Queue a rectangle outline
+	@param x X coordinate
+	@param y Y coordinate
+	@param w width
+	@param h height
+	@param color 565 16-bit color
+	@return rdlib::Success, or rdlib::GenericError if display thread is not running
+*/
+rdlib::Return_Codes_e render_queue::drawRectWH(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
+{
+	RenderCommand_t cmd{};
+	cmd.op = RenderOp_e::Rect;
+	cmd.a = x; cmd.b = y; cmd.c = w; cmd.d = h; cmd.color = color;
+	return enqueue(cmd);
+}
+
+/*!
+	@brief Queue a filled rectangle
+	@param x X coordinate
+	@param y Y coordinate
+	@param w width
+	@param h height
+	@param color 565 16-bit color
+	@return rdlib::Success, or rdlib::GenericError if display thread is not running
+*/
+rdlib::Return_Codes_e render_queue::fillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color)
+{
+	RenderCommand_t cmd{};
+	cmd.op = RenderOp_e::FillRect;
+	cmd.a = x; cmd.b = y; cmd.c = w; cmd.d = h; cmd.color = color;
+	return enqueue(cmd);
+}
+
+/*!
+	@brief Queue a fill of the whole screen
+	@param color 565 16-bit color
+	@return rdlib::Success, or rdlib::GenericError if display thread is not running
+*/
+rdlib::Return_Codes_e render_queue::fillScreen(uint16_t color)
+{
+	RenderCommand_t cmd{};
+	cmd.op = RenderOp_e::FillScreen;
+	cmd.color = color;
+	return enqueue(cmd);
+}
+
+/*!
+	@brief Queue a text cursor move
+	@param x X coordinate
+	@param y Y coordinate
+	@return rdlib::Success, or rdlib::GenericError if display thread is not running
+*/
+rdlib::Return_Codes_e render_queue::setCursor(int16_t x, int16_t y)
+{
+	RenderCommand_t cmd{};
+	cmd.op = RenderOp_e::Cursor;
+	cmd.a = x; cmd.b = y;
+	return enqueue(cmd);
+}
+
+/*!
+	@brief Queue a text color change
+	@param color foreground 565 16-bit color
+	@param bgColor background 565 16-bit color
+	@return rdlib::Success, or rdlib::GenericError if display thread is not running
+*/
+rdlib::Return_Codes_e render_queue::setTextColor(uint16_t color, uint16_t bgColor)
+{
+	RenderCommand_t cmd{};
+	cmd.op = RenderOp_e::TextColor;
+	cmd.color = color; cmd.bgColor = bgColor;
+	return enqueue(cmd);
+}
+
+/*!
+	@brief Queue text at the cursor, the text is copied into the queue
+	@param text null terminated character array
+	@return
+		-# rdlib::Success
+		-# rdlib::CharArrayNullptr
+		-# rdlib::GenericError display thread is not running
+	@note Long text is carried by several commands of TEXT_CHUNK_SIZE chars.
+		Format numbers first, e.g. with snprintf, then queue the text.
+*/
+rdlib::Return_Codes_e render_queue::print(const char* text)
+{
+	if (text == nullptr)
+	{
+		fprintf(stderr, "Error: render_queue print: String is a null pointer.\n");
+		return rdlib::CharArrayNullptr;
+	}
+	size_t remaining = strlen(text);
+	while (remaining > 0)
+	{
+		RenderCommand_t cmd{};
+		cmd.op = RenderOp_e::Text;
+		size_t chunk = (remaining > TEXT_CHUNK_SIZE) ? TEXT_CHUNK_SIZE : remaining;
+		memcpy(cmd.text, text, chunk);
+		cmd.text[chunk] = '\0';
+		rdlib::Return_Codes_e returnCode = enqueue(cmd);
+		if (returnCode != rdlib::Success) return returnCode;
+		text += chunk;
+		remaining -= chunk;
+	}
+	return rdlib::Success;
+}
+
+/*!
+	@brief Queue a user function to run on the display thread
+	@param func function called with the display and context
+	@param context user pointer passed to func, must stay valid until func runs
+	@return rdlib::Success, or rdlib::GenericError if func is null or display thread is not running
+	@details For any display method not covered by the queue, e.g. drawBitmap16.
+*/
+rdlib::Return_Codes_e render_queue::post(CustomFunc_t func, void* context)
+{
+	if (func == nullptr)
+	{
+		fprintf(stderr, "Error: render_queue post: Function is a null pointer.\n");
+		return rdlib::GenericError;
+	}
+	RenderCommand_t cmd{};
+	cmd.op = RenderOp_e::Custom;
+	cmd.func = func; cmd.context = context;
+	return enqueue(cmd);
+}
+
+/*!
+	@brief Queue a flush, writeBuffer when Advanced Screen Buffer mode is on
+	@return rdlib::Success, or rdlib::GenericError if display thread is not running
+	@note With Backpressure_e::Coalesce a flush that reaches the display thread while
+		a newer flush is queued behind it is skipped, the newer one writes its draws too.
+*/
+rdlib::Return_Codes_e render_queue::flush(void)
+{
+	RenderCommand_t cmd{};
+	cmd.op = RenderOp_e::Flush;
+	rdlib::Return_Codes_e returnCode = enqueue(cmd);
+	// counted only once in the ring, a failed flush never makes an older one skip
+	if (returnCode == rdlib::Success) _flushesQueued.fetch_add(1, std::memory_order_acq_rel);
+	return returnCode;
+}
+
+/*!
+	@brief Queue a flush and block until every command queued before it has run
+	@return rdlib::Success, or rdlib::GenericError if display thread is not running
+	@note With Backpressure_e::DropOldest, dropped commands count as completed.
+*/
+rdlib::Return_Codes_e render_queue::flushAndWait(void)
+{
+	rdlib::Return_Codes_e returnCode = flush();
+	if (returnCode != rdlib::Success) return returnCode;
+	uint64_t target = _acceptedCount.load(std::memory_order_acquire);
+	uint64_t done = _completedCount.load(std::memory_order_acquire);
+	while (done < target)
+	{
+		if (!_running.load()) return rdlib::GenericError;
+		_completedCount.wait(done, std::memory_order_acquire);
+		done = _completedCount.load(std::memory_order_acquire);
+	}
+	return rdlib::Success;
+}
+
+/*!
+	@brief Get number of commands discarded by Backpressure_e::DropOldest
+	@return dropped count
+*/
+uint32_t render_queue::getDroppedCount(void) const {return _droppedCount.load();}
+
+/*!
+	@brief Get number of flushes skipped by Backpressure_e::Coalesce
+	@return coalesced count
+*/
+uint32_t render_queue::getCoalescedCount(void) const {return _coalescedCount.load();}
+
+/*!
+	@brief Get the full ring policy
+	@return Backpressure_e enum
+*/
+render_queue::Backpressure_e render_queue::getBackpressure(void) const {return _policy;}
+
+/// @cond
+
+// Push a command applying the backpressure policy, wakes display thread
+rdlib::Return_Codes_e render_queue::enqueue(const RenderCommand_t& cmd)
+{
+	if (!_running.load(std::memory_order_relaxed))
+	{
+		fprintf(stderr, "Error: render_queue: Display thread not running, call start()\n");
+		return rdlib::GenericError;
+	}
+	while (!tryPush(cmd))
+	{
+		if (_policy == Backpressure_e::DropOldest)
+		{
+			RenderCommand_t oldest;
+			if (tryPop(oldest))
+			{
+				if (oldest.op == RenderOp_e::Flush) _flushesQueued.fetch_sub(1, std::memory_order_acq_rel);
+				_droppedCount.fetch_add(1, std::memory_order_relaxed);
+				_completedCount.fetch_add(1, std::memory_order_release);
+				_completedCount.notify_all();
+			}
+		}
+		else
+		{
+			// Block and Coalesce: sleep until the display thread completes a command
+			uint64_t done = _completedCount.load(std::memory_order_acquire);
+			if (tryPush(cmd)) break;
+			if (!_running.load()) return rdlib::GenericError;
+			_completedCount.wait(done, std::memory_order_acquire);
+		}
+	}
+	_acceptedCount.fetch_add(1, std::memory_order_release);
+	_wakeCounter.fetch_add(1, std::memory_order_release);
+	_wakeCounter.notify_one();
+	return rdlib::Success;
+}
+
+// Bounded MPMC ring push, false if full
+bool render_queue::tryPush(const RenderCommand_t& cmd)
+{
+	Cell_t* cell;
+	size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		cell = &_cells[pos & _mask];
+		size_t seq = cell->sequence.load(std::memory_order_acquire);
+		intptr_t dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+		if (dif == 0)
+		{
+			if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				break;
+		}
+		else if (dif < 0)
+			return false;
+		else
+			pos = _enqueuePos.load(std::memory_order_relaxed);
+	}
+	cell->cmd = cmd;
+	cell->sequence.store(pos + 1, std::memory_order_release);
+	return true;
+}
+
+// Bounded MPMC ring pop, false if empty
+bool render_queue::tryPop(RenderCommand_t& cmd)
+{
+	Cell_t* cell;
+	size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		cell = &_cells[pos & _mask];
+		size_t seq = cell->sequence.load(std::memory_order_acquire);
+		intptr_t dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+		if (dif == 0)
+		{
+			if (_dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				break;
+		}
+		else if (dif < 0)
+			return false;
+		else
+			pos = _dequeuePos.load(std::memory_order_relaxed);
+	}
+	cmd = cell->cmd;
+	cell->sequence.store(pos + _mask + 1, std::memory_order_release);
+	return true;
+}
+
+// Run one command on the display
+void render_queue::execute(const RenderCommand_t& cmd)
+{
+	switch (cmd.op)
+	{
+		case RenderOp_e::Pixel: _display.drawPixel(cmd.a, cmd.b, cmd.color); break;
+		case RenderOp_e::Line: _display.drawLine(cmd.a, cmd.b, cmd.c, cmd.d, cmd.color); break;
+		case RenderOp_e::Rect: _display.drawRectWH(cmd.a, cmd.b, cmd.c, cmd.d, cmd.color); break;
+		case RenderOp_e::FillRect: _display.fillRect(cmd.a, cmd.b, cmd.c, cmd.d, cmd.color); break;
+		case RenderOp_e::FillScreen: _display.fillScreen(cmd.color); break;
+		case RenderOp_e::Cursor: _display.setCursor(cmd.a, cmd.b); break;
+		case RenderOp_e::TextColor: _display.setTextColor(cmd.color, cmd.bgColor); break;
+		case RenderOp_e::Text: _display.print(cmd.text); break;
+		case RenderOp_e::Custom: cmd.func(_display, cmd.context); break;
+		case RenderOp_e::Flush:
+			// ring is FIFO, so another queued flush is behind this one and covers its draws
+			if (_flushesQueued.fetch_sub(1, std::memory_order_acq_rel) > 1 && _policy == Backpressure_e::Coalesce)
+			{
+				_coalescedCount.fetch_add(1, std::memory_order_relaxed);
+				break;
+			}
+			if (_display.getAdvancedScreenBuffer_e() == color16_graphics::AdvancedScreenBuffer_e::On)
+				_display.writeBuffer();
+		break;
+	}
+}
+
+// Display thread, owns the transport, drains the ring until stopped and empty
+void render_queue::displayThread(void)
+{
+	RenderCommand_t cmd;
+	for (;;)
+	{
+		uint32_t wake = _wakeCounter.load(std::memory_order_acquire);
+		if (tryPop(cmd))
+		{
+			execute(cmd);
+			_completedCount.fetch_add(1, std::memory_order_release);
+			_completedCount.notify_all();
+			continue;
+		}
+		if (!_running.load()) break;
+		_wakeCounter.wait(wake, std::memory_order_acquire);
+	}
+	_completedCount.notify_all();
+}
+
+/// @endcond
+
+// **************** EOF *****************
@@ -79,6 +79,7 @@ rdlib::Return_Codes_e SH110X_RDL::OLEDSetBufferPtr(uint8_t width, uint8_t height
 		return rdlib::BufferEmpty;
 	}
 	_OLEDbuffer = buffer;
+	setPageBuffer(_OLEDbuffer, _OLED_WIDTH);
 	return rdlib::Success;
 }
 
@@ -123,6 +124,7 @@ rdlib::Return_Codes_e SH110X_RDL::OLED_I2C_ON(int I2C_device, int I2C_addr , int
 */
 rdlib::Return_Codes_e  SH110X_RDL::OLED_I2C_OFF(void)
 {
+	commitAsyncEnd();
 	uint8_t ErrorFlag = 0; // Becomes >0 in event of error
 	
 	// 1 Is reset pin being used?
@@ -172,6 +174,7 @@ rdlib::Return_Codes_e  SH110X_RDL::OLED_I2C_OFF(void)
 */
 void SH110X_RDL::OLEDPowerDown(void)
 {
+	commitAsyncEnd();
 	OLEDEnable(0);
 	delayMilliSecRDL(100);
 }
@@ -194,6 +197,7 @@ void SH110X_RDL::OLEDinit()
 			SH1106_begin();
 		break;
 	}
+	_pageBuffer.resendAll();
 }
 
 /*!
@@ -350,14 +354,7 @@ void SH110X_RDL::OLEDFillScreen(uint8_t dataPattern, uint8_t delay)
 	
 	for (uint8_t row = 0; row < _OLED_PAGE_NUM; row++)
 	{
-		I2CWriteByte( SH110X_SETPAGEADDR  | row);
-		I2CWriteByte(SH110X_SETLOWCOLUMN + (pageStartOffset & 0x0F));
-		I2CWriteByte(SH110X_SETHIGHCOLUMN + (pageStartOffset >> 4 )); // 0x10 | 2 >>4 = 10
-		for (uint8_t col = 0; col < _OLED_WIDTH; col++)
-		{
-			I2CWriteByte(dataPattern, SH110X_DATA_BYTE);
-			delayMilliSecRDL(delay);
-		}
+		OLEDFillPage(row, dataPattern, delay);
 	}
 }
 
@@ -366,14 +363,24 @@ void SH110X_RDL::OLEDFillScreen(uint8_t dataPattern, uint8_t delay)
 	@param page_num chosen page (1-X)
 	@param dataPattern can be set to 0 to FF (not buffer)
 	@param mydelay optional delay in milliseconds can be set to zero normally.
+	@note With mydelay 0 the page is sent in one I2C write, else byte by byte.
+		The page is sent in full by the next OLEDupdate.
 */
 void SH110X_RDL::OLEDFillPage(uint8_t page_num, uint8_t dataPattern,uint8_t mydelay)
 {
+	_pageBuffer.resendPage(page_num);
 	uint8_t Result =SH110X_SETPAGEADDR | page_num;
 	I2CWriteByte(Result);
 	I2CWriteByte(SH110X_SETLOWCOLUMN + (pageStartOffset & 0x0F)); // SH110X_SETLOWCOLUMN   = 0x00
 	I2CWriteByte(SH110X_SETHIGHCOLUMN + (pageStartOffset >> 4));
 	uint8_t numofbytes = _OLED_WIDTH;
+	if (mydelay == 0)
+	{
+		uint8_t pageData[256];
+		std::fill_n(pageData, numofbytes, dataPattern);
+		I2CWriteData(std::span<const uint8_t>(pageData, numofbytes));
+		return;
+	}
 	for (uint8_t i = 0; i < numofbytes; i++)
 	{
 		I2CWriteByte(dataPattern, SH110X_DATA_BYTE);
@@ -389,11 +396,41 @@ void SH110X_RDL::OLEDFillPage(uint8_t page_num, uint8_t dataPattern,uint8_t myde
 */
 void SH110X_RDL::I2CWriteByte(uint8_t value, uint8_t cmd)
 {
-	char ByteBuffer[2] = {cmd,value};
+	char ByteBuffer[2] = {static_cast<char>(cmd), static_cast<char>(value)};
+	I2CWriteRetry(ByteBuffer, 2);
+}
+
+/*!
+	@brief Writes display data to I2C address, one control byte then the data, used internally
+	@param data the data bytes for display RAM
+	@details Split into writes of _I2CChunkSize data bytes each led by a data control byte,
+		so a page of 128 bytes is one I2C transaction instead of 128.
+*/
+void SH110X_RDL::I2CWriteData(std::span<const uint8_t> data)
+{
+	char chunkBuffer[I2C_CHUNK_MAX + 1];
+	chunkBuffer[0] = static_cast<char>(SH110X_DATA_BYTE);
+	while (!data.empty())
+	{
+		size_t count = std::min<size_t>(data.size(), _I2CChunkSize);
+		std::copy_n(data.begin(), count, chunkBuffer + 1);
+		I2CWriteRetry(chunkBuffer, static_cast<int>(count + 1));
+		data = data.subspan(count);
+	}
+}
+
+/*!
+	@brief Writes a buffer to I2C address with retries, used internally
+	@param buffer bytes to write, control byte first
+	@param length number of bytes
+	@note isDebugEnabled()  ,will output data on I2C failures.
+*/
+void SH110X_RDL::I2CWriteRetry(char* buffer, int length)
+{
 	uint8_t attemptI2Cwrite = _I2C_ErrorRetryNum;
 	int  ReasonCodes = 0;
 	
-	ReasonCodes =Display_RDL_I2C_WRITE(_OLEDI2CHandle, ByteBuffer, 2); 
+	ReasonCodes =Display_RDL_I2C_WRITE(_OLEDI2CHandle, buffer, length); 
 	while(ReasonCodes < 0)
 	{//failure to write I2C byte ,Error handling retransmit
 		
@@ -403,12 +440,13 @@ void SH110X_RDL::I2CWriteByte(uint8_t value, uint8_t cmd)
 			fprintf(stderr, "Attempt Count: %u\n", attemptI2Cwrite);
 		}
 		delayMilliSecRDL(_I2C_ErrorDelay); // delay mS
-		ReasonCodes =Display_RDL_I2C_WRITE(_OLEDI2CHandle, ByteBuffer, 2); //retry
+		ReasonCodes =Display_RDL_I2C_WRITE(_OLEDI2CHandle, buffer, length); //retry
 		_I2C_ErrorFlag = ReasonCodes; // set reasonCode to flag
 		attemptI2Cwrite--; // Decrement retry attempt
 		if (attemptI2Cwrite == 0) break;
 	}
 	_I2C_ErrorFlag = ReasonCodes;
+	if (ReasonCodes < 0) _I2CWriteFailed = true;
 }
 
 /*!
@@ -416,6 +454,10 @@ void SH110X_RDL::I2CWriteByte(uint8_t value, uint8_t cmd)
 	@return 
 		-# Success 
 		-# BufferEmpty if buffer is empty object
+	@details Only the columns changed since the last update are sent, each changed
+		page gets its page and column address commands then one I2C data write.
+		Unchanged pages are skipped. If an I2C write fails the whole buffer is sent
+		on the next update. Blocks until sent, see commitAsync to send in the background.
 */
 rdlib::Return_Codes_e SH110X_RDL::OLEDupdate()
 {
@@ -424,12 +466,33 @@ rdlib::Return_Codes_e SH110X_RDL::OLEDupdate()
 		fprintf(stderr, "Error: OLEDupdate: Buffer is empty, cannot update screen\r\n");
 		return rdlib::BufferEmpty;
 	}
-	uint8_t w = this->_OLED_WIDTH; 
-	uint8_t h = this->_OLED_HEIGHT;
-	OLEDBufferScreen(w,  h, this->_OLEDbuffer);
+	updateFrame(_OLEDbuffer);
 	return rdlib::Success;
 }
 
+/*!
+	@brief Sends the changed columns of a frame, used by OLEDupdate and commitAsync
+	@param frame screen buffer or a committed copy of it
+	@param dirty column range to send of each page
+	@return rdlib::Success, or rdlib::GenericError if any I2C command or data write failed
+*/
+rdlib::Return_Codes_e SH110X_RDL::sendFrame(std::span<const uint8_t> frame,
+		std::span<const page_buffer_1bpp::DirtyRange_t> dirty)
+{
+	const uint8_t pages = std::min<size_t>(_OLED_PAGE_NUM, dirty.size());
+	_I2CWriteFailed = false;
+	for (uint8_t page = 0; page < pages; page++)
+	{
+		if (dirty[page].first > dirty[page].last) continue;
+		uint8_t column = static_cast<uint8_t>(dirty[page].first + pageStartOffset);
+		I2CWriteByte(SH110X_SETPAGEADDR + page);
+		I2CWriteByte(SH110X_SETLOWCOLUMN + (column & 0x0F));
+		I2CWriteByte(SH110X_SETHIGHCOLUMN + (column >> 4));
+		I2CWriteData(frame.subspan((page * _OLED_WIDTH) + dirty[page].first, dirty[page].last - dirty[page].first + 1));
+	}
+	return _I2CWriteFailed ? rdlib::GenericError : rdlib::Success;
+}
+
 /*!
 	@brief clears the buffer memory i.e. does NOT write to the screen
 	@return 
@@ -445,6 +508,7 @@ rdlib::Return_Codes_e SH110X_RDL::OLEDclearBuffer()
 	}
 
 	std::fill(_OLEDbuffer.begin(), _OLEDbuffer.end(), 0x00);
+	_pageBuffer.markAllDirty();
 	return rdlib::Success;
 }
 
@@ -453,11 +517,14 @@ rdlib::Return_Codes_e SH110X_RDL::OLEDclearBuffer()
 	@param w width
 	@param h height
 	@param data the buffer data
-	@note Called by OLEDupdate internally
+	@note Each page is sent as one I2C data write (split at OLEDI2CChunkSizeSet limit)
+		after its page and column address commands. The screen buffer is sent in full
+		by the next OLEDupdate.
 */
 void SH110X_RDL::OLEDBufferScreen(uint8_t w, uint8_t h, std::span<uint8_t> data)
 {
 	uint8_t page;
+	_pageBuffer.resendAll();
 
 	for (page = 0; page < (h/8); page++) 
 	{
@@ -465,54 +532,11 @@ void SH110X_RDL::OLEDBufferScreen(uint8_t w, uint8_t h, std::span<uint8_t> data)
 		I2CWriteByte(SH110X_SETLOWCOLUMN + (pageStartOffset & 0x0F)); // SH110X_SETLOWCOLUMN   = 0x00
 		I2CWriteByte(SH110X_SETHIGHCOLUMN + (pageStartOffset >> 4));
 		//write data
-		for(int i = 0; i< w; i++ ) 
-		{
-			I2CWriteByte(data[i+page*w], SH110X_DATA_BYTE);
-		}
+		I2CWriteData(data.subspan(page * w, w));
 	}
 
 }
 
-/*!
-	@brief Draws a Pixel to the screen overrides the graphics lib
-	@param x x axis  position
-	@param y y axis  position
-	@param color color of pixel.
-*/
-void SH110X_RDL::drawPixel(int16_t x, int16_t y, uint8_t color)
-{
-
-	if ((x < 0) || (x >= this->_width) || (y < 0) || (y >= this->_height)) {
-	return;
-	}
-	int16_t temp;
-	uint8_t rotation = getRotation();
-	switch (rotation) {
-	case 1:
-		temp = x;
-		x = WIDTH - 1 - y;
-		y = temp;
-	break;
-	case 2:
-		x = WIDTH - 1 - x;
-		y = HEIGHT - 1 - y;
-	break;
-	case 3:
-		temp = x;
-		x = y;
-		y = HEIGHT - 1 - temp;
-	break;
-	}
-	uint16_t tc = (_OLED_WIDTH * (y /8)) + x;
-	switch (color)
-	{
-		case WHITE:  this->_OLEDbuffer[tc] &= ~(1 << (y & 7)); break;
-		case BLACK:  this->_OLEDbuffer[tc] |= (1 << (y & 7)); break;
-		case INVERSE: this->_OLEDbuffer[tc] ^= (1 << (y & 7)); break;
-	}
-}
-
-
 /*!
 	@brief get I2C error Flag
 	@details See Error Codes at bottom of https://abyz.me.uk/lg/lgpio.html
@@ -554,6 +578,23 @@ void SH110X_RDL::OLEDI2CErrorRetryNumSet(uint8_t AttemptCount)
 	_I2C_ErrorRetryNum = AttemptCount;
 }
 
+/*!
+	@brief Gets the number of data bytes sent per I2C write by OLEDupdate
+	@return data bytes per I2C write
+*/
+uint16_t SH110X_RDL::OLEDI2CChunkSizeGet(void){return _I2CChunkSize;}
+
+/*!
+	@brief Sets the number of data bytes sent per I2C write by OLEDupdate
+	@param chunkSize data bytes per I2C write 1-256, default 256.
+		Lower it if the I2C adapter has a small transfer limit.
+*/
+void SH110X_RDL::OLEDI2CChunkSizeSet(uint16_t chunkSize)
+{
+	if (chunkSize == 0) chunkSize = 1;
+	_I2CChunkSize = std::min(chunkSize, I2C_CHUNK_MAX);
+}
+
 /*!
 	@brief checks if OLED on I2C bus
 	@return lg Error codes, LG_OKAY   0x00 = Success
@@ -0,0 +1,169 @@
+/*!
+	@file     spi_bus_arbiter_RDL.cpp
+	@author   Gavin Lyons
+	@brief    Source file for sharing one SPI bus between several displays
+*/
+
+#include "../include/spi_bus_arbiter_RDL.hpp"
+
+// Section : spi_bus_arbiter
+
+/*!
+	@brief Constructor for class spi_bus_arbiter
+	@param policy scheduling policy between waiting devices
+*/
+spi_bus_arbiter::spi_bus_arbiter(Policy_e policy) : _policy(policy) {}
+
+/*!
+	@brief Register a display on the bus
+	@param priority device priority used by Policy_e::Priority, higher goes first
+	@return device ID to pass to acquire and release
+*/
+int spi_bus_arbiter::registerDevice(uint8_t priority)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_priorities.push_back(priority);
+	_transactions.push_back(0);
+	return static_cast<int>(_priorities.size() - 1);
+}
+
+/*!
+	@brief Acquire the bus, blocks until granted
+	@param deviceID ID returned by registerDevice
+	@note Recursive, a thread already holding the bus gets it straight away.
+*/
+void spi_bus_arbiter::acquire(int deviceID)
+{
+	std::unique_lock<std::mutex> lock(_mutex);
+	std::thread::id self = std::this_thread::get_id();
+	if (_ownerThread == self)
+	{
+		_ownerDepth++;
+		return;
+	}
+	uint8_t priority = 0;
+	if (deviceID >= 0 && static_cast<size_t>(deviceID) < _priorities.size())
+		priority = _priorities[deviceID];
+
+	uint64_t ticket = _nextTicket++;
+	_waiters.push_back({ticket, priority});
+	_cond.wait(lock, [this, ticket]() {
+		return _ownerThread == std::thread::id{} && isNextWaiter(ticket);
+	});
+	for (auto it = _waiters.begin(); it != _waiters.end(); ++it)
+	{
+		if (it->ticket == ticket)
+		{
+			_waiters.erase(it);
+			break;
+		}
+	}
+	_ownerThread = self;
+	_ownerDepth = 1;
+	if (deviceID >= 0 && static_cast<size_t>(deviceID) < _transactions.size())
+		_transactions[deviceID]++;
+}
+
+/*!
+	@brief Release the bus
+	@param deviceID ID returned by registerDevice
+*/
+void spi_bus_arbiter::release(int deviceID)
+{
+	(void)deviceID;
+	{
+		std::lock_guard<std::mutex> lock(_mutex);
+		if (_ownerThread != std::this_thread::get_id())
+		{
+			fprintf(stderr, "Error: spi_bus_arbiter release: Bus not held by calling thread\n");
+			return;
+		}
+		if (--_ownerDepth > 0) return;
+		_ownerThread = std::thread::id{};
+	}
+	_cond.notify_all();
+}
+
+/*!
+	@brief Set the scheduling policy
+	@param policy Fair or Priority
+*/
+void spi_bus_arbiter::setPolicy(Policy_e policy)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	_policy = policy;
+}
+
+/*!
+	@brief Get the scheduling policy
+	@return Policy_e enum
+*/
+spi_bus_arbiter::Policy_e spi_bus_arbiter::getPolicy(void) const {return _policy;}
+
+/*!
+	@brief Get the number of times a device has been granted the bus
+	@param deviceID ID returned by registerDevice
+	@return transaction count, 0 for unknown ID
+*/
+uint32_t spi_bus_arbiter::getTransactionCount(int deviceID)
+{
+	std::lock_guard<std::mutex> lock(_mutex);
+	if (deviceID < 0 || static_cast<size_t>(deviceID) >= _transactions.size())
+		return 0;
+	return _transactions[deviceID];
+}
+
+/// @cond
+
+// Is ticket the waiter to be granted the bus next under the current policy, _mutex held
+bool spi_bus_arbiter::isNextWaiter(uint64_t ticket) const
+{
+	const Waiter_t* next = nullptr;
+	for (const Waiter_t& waiter : _waiters)
+	{
+		if (next == nullptr)
+			next = &waiter;
+		else if (_policy == Policy_e::Priority && waiter.priority != next->priority)
+		{
+			if (waiter.priority > next->priority) next = &waiter;
+		}
+		else if (waiter.ticket < next->ticket)
+			next = &waiter;
+	}
+	return next != nullptr && next->ticket == ticket;
+}
+
+/// @endcond
+
+// Section : spi_bus_device
+
+/*!
+	@brief Attach display to a shared SPI bus
+	@param bus arbiter shared by all displays on the same SPI device
+	@param priority device priority used by Policy_e::Priority
+	@return rdlib::Success
+	@note Call before starting display threads. The arbiter must outlive the display.
+*/
+rdlib::Return_Codes_e spi_bus_device::SPIBusAttach(spi_bus_arbiter& bus, uint8_t priority)
+{
+	_spiBus = &bus;
+	_spiBusID = bus.registerDevice(priority);
+	return rdlib::Success;
+}
+
+/*!
+	@brief Detach display from shared SPI bus, SPI is then used without arbitration
+*/
+void spi_bus_device::SPIBusDetach(void)
+{
+	_spiBus = nullptr;
+	_spiBusID = -1;
+}
+
+/*!
+	@brief Get the shared bus arbiter
+	@return pointer to arbiter, nullptr if not attached
+*/
+spi_bus_arbiter* spi_bus_device::SPIBusGet(void) const {return _spiBus;}
+
+// **************** EOF *****************
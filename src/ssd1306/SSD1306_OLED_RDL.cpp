@@ -53,6 +53,7 @@ rdlib::Return_Codes_e SSD1306_RDL::OLEDSetBufferPtr(uint8_t width, uint8_t heigh
 		return rdlib::BufferEmpty;
 	}
 	_OLEDbuffer = buffer;
+	setPageBuffer(_OLEDbuffer, _OLED_WIDTH);
 	return rdlib::Success;
 }
 
@@ -95,6 +96,7 @@ rdlib::Return_Codes_e SSD1306_RDL::OLED_I2C_ON(int I2C_device, int I2C_addr , in
 */
 rdlib::Return_Codes_e  SSD1306_RDL::OLED_I2C_OFF(void)
 {
+	commitAsyncEnd();
 	int I2COpenHandleStatus = 0;
 	I2COpenHandleStatus = Display_RDL_I2C_CLOSE(_OLEDI2CHandle);
 	if (I2COpenHandleStatus < 0 )
@@ -110,6 +112,7 @@ rdlib::Return_Codes_e  SSD1306_RDL::OLED_I2C_OFF(void)
 */
 void SSD1306_RDL::OLEDPowerDown(void)
 {
+	commitAsyncEnd();
 	OLEDEnable(0);
 	delayMilliSecRDL(100);
 }
@@ -174,6 +177,7 @@ switch (_OLED_HEIGHT)
 	I2CWriteByte( SSD1306_DISPLAY_ON );
 
 	delayMilliSecRDL(SSD1306_INITDELAY);
+	_pageBuffer.resendAll();
 }
 
 /*!
@@ -213,14 +217,7 @@ void SSD1306_RDL::OLEDFillScreen(uint8_t dataPattern, uint8_t delay)
 {
 	for (uint8_t row = 0; row < _OLED_PAGE_NUM; row++)
 	{
-		I2CWriteByte( 0xB0 | row);
-		I2CWriteByte(SSD1306_SET_LOWER_COLUMN);
-		I2CWriteByte(SSD1306_SET_HIGHER_COLUMN);
-		for (uint8_t col = 0; col < _OLED_WIDTH; col++)
-		{
-			I2CWriteByte(dataPattern, SSD1306_DATA_CONTINUE);
-			delayMilliSecRDL(delay);
-		}
+		OLEDFillPage(row, dataPattern, delay);
 	}
 }
 
@@ -229,14 +226,21 @@ void SSD1306_RDL::OLEDFillScreen(uint8_t dataPattern, uint8_t delay)
 	@param page_num chosen page (1-8)
 	@param dataPattern can be set to 0 to FF (not buffer)
 	@param mydelay optional delay in milliseconds can be set to zero normally.
+	@note With mydelay 0 the page is sent in one I2C write, else byte by byte.
+		The page is sent in full by the next OLEDupdate.
 */
 void SSD1306_RDL::OLEDFillPage(uint8_t page_num, uint8_t dataPattern,uint8_t mydelay)
 {
-	uint8_t Result =0xB0 | page_num; 
-	I2CWriteByte(Result);
-	I2CWriteByte(SSD1306_SET_LOWER_COLUMN);
-	I2CWriteByte(SSD1306_SET_HIGHER_COLUMN);
+	I2CSetWindow(0, _OLED_WIDTH - 1, page_num, page_num);
+	_pageBuffer.resendPage(page_num);
 	uint8_t numofbytes = _OLED_WIDTH;
+	if (mydelay == 0)
+	{
+		uint8_t pageData[256];
+		std::fill_n(pageData, numofbytes, dataPattern);
+		I2CWriteData(std::span<const uint8_t>(pageData, numofbytes));
+		return;
+	}
 	for (uint8_t i = 0; i < numofbytes; i++)
 	{
 		I2CWriteByte(dataPattern, SSD1306_DATA_CONTINUE);
@@ -252,11 +256,59 @@ void SSD1306_RDL::OLEDFillPage(uint8_t page_num, uint8_t dataPattern,uint8_t myd
 */
 void SSD1306_RDL::I2CWriteByte(uint8_t value, uint8_t cmd)
 {
-	char ByteBuffer[2] = {cmd,value};
+	char ByteBuffer[2] = {static_cast<char>(cmd), static_cast<char>(value)};
+	I2CWriteRetry(ByteBuffer, 2);
+}
+
+/*!
+	@brief Writes display data to I2C address, one control byte then the data, used internally
+	@param data the data bytes for display RAM
+	@details Split into writes of _I2CChunkSize data bytes each led by a data control byte,
+		so a page of 128 bytes is one I2C transaction instead of 128.
+*/
+void SSD1306_RDL::I2CWriteData(std::span<const uint8_t> data)
+{
+	char chunkBuffer[I2C_CHUNK_MAX + 1];
+	chunkBuffer[0] = static_cast<char>(SSD1306_DATA_CONTINUE);
+	while (!data.empty())
+	{
+		size_t count = std::min<size_t>(data.size(), _I2CChunkSize);
+		std::copy_n(data.begin(), count, chunkBuffer + 1);
+		I2CWriteRetry(chunkBuffer, static_cast<int>(count + 1));
+		data = data.subspan(count);
+	}
+}
+
+/*!
+	@brief Sets the column and page window that display data is written to, used internally
+	@param colFirst first column
+	@param colLast last column
+	@param pageFirst first page
+	@param pageLast last page
+	@details Horizontal addressing mode, data wraps from colLast to colFirst of the next page.
+*/
+void SSD1306_RDL::I2CSetWindow(uint8_t colFirst, uint8_t colLast, uint8_t pageFirst, uint8_t pageLast)
+{
+	I2CWriteByte( SSD1306_SET_COLUMN_ADDR );
+	I2CWriteByte( colFirst );
+	I2CWriteByte( colLast );
+	I2CWriteByte( SSD1306_SET_PAGE_ADDR );
+	I2CWriteByte( pageFirst );
+	I2CWriteByte( pageLast );
+}
+
+/*!
+	@brief Writes a buffer to I2C address with retries, used internally
+	@param buffer bytes to write, control byte first
+	@param length number of bytes
+	@note isDebugEnabled()  ,will output data on I2C failures.
+*/
+void SSD1306_RDL::I2CWriteRetry(char* buffer, int length)
+{
 	uint8_t attemptI2Cwrite = _I2C_ErrorRetryNum;
 	int  ReasonCodes = 0;
 	
-	ReasonCodes =Display_RDL_I2C_WRITE(_OLEDI2CHandle, ByteBuffer, 2); 
+	ReasonCodes =Display_RDL_I2C_WRITE(_OLEDI2CHandle, buffer, length); 
 	while(ReasonCodes < 0)
 	{//failure to write I2C byte ,Error handling retransmit
 		
@@ -266,12 +318,13 @@ void SSD1306_RDL::I2CWriteByte(uint8_t value, uint8_t cmd)
 			fprintf(stderr, "Attempt Count: %u\n", attemptI2Cwrite);
 		}
 		delayMilliSecRDL(_I2C_ErrorDelay); // delay mS
-		ReasonCodes =Display_RDL_I2C_WRITE(_OLEDI2CHandle, ByteBuffer, 2); //retry
+		ReasonCodes =Display_RDL_I2C_WRITE(_OLEDI2CHandle, buffer, length); //retry
 		_I2C_ErrorFlag = ReasonCodes; // set reasonCode to flag
 		attemptI2Cwrite--; // Decrement retry attempt
 		if (attemptI2Cwrite == 0) break;
 	}
 	_I2C_ErrorFlag = ReasonCodes;
+	if (ReasonCodes < 0) _I2CWriteFailed = true;
 }
 
 /*!
@@ -279,6 +332,11 @@ void SSD1306_RDL::I2CWriteByte(uint8_t value, uint8_t cmd)
 	@return 
 		-# Success 
 		-# BufferEmpty if buffer is empty object
+	@details Only the columns changed since the last update are sent. Each run of
+		changed pages is sent as one column/page address window covering their
+		changed columns, so a frame where nothing changed sends nothing.
+		If an I2C write fails the whole buffer is sent on the next update.
+		Blocks until sent, see commitAsync to send in the background.
 */
 rdlib::Return_Codes_e SSD1306_RDL::OLEDupdate()
 {
@@ -287,14 +345,47 @@ rdlib::Return_Codes_e SSD1306_RDL::OLEDupdate()
 		fprintf(stderr, "Error: OLEDupdate: Buffer is empty, cannot update screen\r\n");
 		return rdlib::BufferEmpty;
 	}
-	uint8_t x = 0; 
-	uint8_t y = 0; 
-	uint8_t w = this->_OLED_WIDTH; 
-	uint8_t h = this->_OLED_HEIGHT;
-	OLEDBufferScreen( x,  y,  w,  h, this->_OLEDbuffer);
+	updateFrame(_OLEDbuffer);
 	return rdlib::Success;
 }
 
+/*!
+	@brief Sends the changed columns of a frame, used by OLEDupdate and commitAsync
+	@param frame screen buffer or a committed copy of it
+	@param dirty column range to send of each page
+	@return rdlib::Success, or rdlib::GenericError if any I2C command or data write failed
+*/
+rdlib::Return_Codes_e SSD1306_RDL::sendFrame(std::span<const uint8_t> frame,
+		std::span<const page_buffer_1bpp::DirtyRange_t> dirty)
+{
+	const uint8_t pages = std::min<size_t>(_OLED_PAGE_NUM, dirty.size());
+	_I2CWriteFailed = false;
+	uint8_t pageFirst = 0;
+	while (pageFirst < pages)
+	{
+		if (dirty[pageFirst].first > dirty[pageFirst].last)
+		{
+			pageFirst++;
+			continue;
+		}
+		// extend the window over the following changed pages
+		uint8_t pageLast = pageFirst;
+		int16_t colFirst = dirty[pageFirst].first;
+		int16_t colLast = dirty[pageFirst].last;
+		while (pageLast + 1 < pages && dirty[pageLast + 1].first <= dirty[pageLast + 1].last)
+		{
+			pageLast++;
+			colFirst = std::min(colFirst, dirty[pageLast].first);
+			colLast = std::max(colLast, dirty[pageLast].last);
+		}
+		I2CSetWindow(colFirst, colLast, pageFirst, pageLast);
+		for (uint8_t page = pageFirst; page <= pageLast; page++)
+			I2CWriteData(frame.subspan((page * _OLED_WIDTH) + colFirst, colLast - colFirst + 1));
+		pageFirst = pageLast + 1;
+	}
+	return _I2CWriteFailed ? rdlib::GenericError : rdlib::Success;
+}
+
 /*!
 	@brief clears the buffer memory i.e. does NOT write to the screen
 	@return 
@@ -310,6 +401,7 @@ rdlib::Return_Codes_e SSD1306_RDL::OLEDclearBuffer()
 	}
 
 	std::fill(_OLEDbuffer.begin(), _OLEDbuffer.end(), 0x00);
+	_pageBuffer.markAllDirty();
 	return rdlib::Success;
 }
 
@@ -320,81 +412,37 @@ rdlib::Return_Codes_e SSD1306_RDL::OLEDclearBuffer()
 	@param w width
 	@param h height
 	@param data the span of the buffer data
-	@note Called by OLEDupdate internally 
+	@note The visible bytes of each page are sent as one I2C data write
+		(split at OLEDI2CChunkSizeSet limit). The screen buffer is sent in full
+		by the next OLEDupdate.
 */
 void SSD1306_RDL::OLEDBufferScreen(int16_t x, int16_t y, uint8_t w, uint8_t h,  std::span<uint8_t> data)
 {
 	
 	uint8_t tx, ty;
 	uint16_t offset = 0;
-		
-	I2CWriteByte( SSD1306_SET_COLUMN_ADDR );
-	I2CWriteByte(0);   // Column start address (0 = reset)
-	I2CWriteByte( _OLED_WIDTH-1 ); // Column end address (127 = reset)
+	uint8_t pageData[256];
+	uint16_t count = 0;
 
-	I2CWriteByte( SSD1306_SET_PAGE_ADDR );
-	I2CWriteByte(0); // Page start address (0 = reset)
-	
-	switch (_OLED_HEIGHT)
-	{
-		case 64: I2CWriteByte(7); break;
-		case 32: I2CWriteByte(3); break;
-		case 16: I2CWriteByte(1); break;
-	}
+	I2CSetWindow(0, _OLED_WIDTH - 1, 0, _OLED_PAGE_NUM - 1);
+	_pageBuffer.resendAll();
 	
 	for (ty = 0; ty < h; ty = ty + 8)
 		{
 		if (y + ty < 0 || y + ty >= _OLED_HEIGHT) {continue;}
+		count = 0;
 		for (tx = 0; tx < w; tx++)
 		{
 
 			if (x + tx < 0 || x + tx >= _OLED_WIDTH) {continue;}
 			offset = (w * (ty /8)) + tx;
-			I2CWriteByte(data[offset++], SSD1306_DATA_CONTINUE);
+			pageData[count++] = data[offset];
 		}
+		I2CWriteData(std::span<const uint8_t>(pageData, count));
 	}
 
 }
 
-/*!
-	@brief Draws a Pixel to the screen overrides the graphics lib
-	@param x x axis  position  
-	@param y y axis  position
-	@param color color of pixel.
-*/
-void SSD1306_RDL::drawPixel(int16_t x, int16_t y, uint8_t color)
-{
-
-	if ((x < 0) || (x >= this->_width) || (y < 0) || (y >= this->_height)) {
-	return;
-	}
-	int16_t temp;
-	uint8_t rotation = getRotation();
-	switch (rotation) {
-	case 1:
-		temp = x;
-		x = WIDTH - 1 - y;
-		y = temp;
-	break;
-	case 2:
-		x = WIDTH - 1 - x;
-		y = HEIGHT - 1 - y;
-	break;
-	case 3:
-		temp = x;
-		x = y;
-		y = HEIGHT - 1 - temp;
-	break;
-	}
-	uint16_t tc = (_OLED_WIDTH * (y /8)) + x;
-	switch (color)
-	{
-		case WHITE:  this->_OLEDbuffer[tc] &= ~(1 << (y & 7)); break;
-		case BLACK:  this->_OLEDbuffer[tc] |= (1 << (y & 7)); break;
-		case INVERSE: this->_OLEDbuffer[tc] ^= (1 << (y & 7)); break;
-	}
-}
-
 /*!
 	@brief Scroll OLED data to the right
 	@param start start position
@@ -478,6 +526,7 @@ void SSD1306_RDL::OLEDStopScroll(void)
 {
 	
 	I2CWriteByte(SSD1306_DEACTIVATE_SCROLL);
+	_pageBuffer.resendAll(); // display RAM must be rewritten after scrolling
 }
 
 
@@ -521,6 +570,23 @@ void SSD1306_RDL::OLEDI2CErrorRetryNumSet(uint8_t AttemptCount)
 	_I2C_ErrorRetryNum = AttemptCount;
 }
 
+/*!
+	@brief Gets the number of data bytes sent per I2C write by OLEDupdate
+	@return data bytes per I2C write
+*/
+uint16_t SSD1306_RDL::OLEDI2CChunkSizeGet(void){return _I2CChunkSize;}
+
+/*!
+	@brief Sets the number of data bytes sent per I2C write by OLEDupdate
+	@param chunkSize data bytes per I2C write 1-256, default 256.
+		Lower it if the I2C adapter has a small transfer limit.
+*/
+void SSD1306_RDL::OLEDI2CChunkSizeSet(uint16_t chunkSize)
+{
+	if (chunkSize == 0) chunkSize = 1;
+	_I2CChunkSize = std::min(chunkSize, I2C_CHUNK_MAX);
+}
+
 /*!
 	@brief checks if OLED on I2C bus
 	@return lg Error codes, LG_OKAY   0x00 = Success
@@ -344,6 +344,20 @@ void ST7789_TFT ::TFTidleDisplay(bool idleMode){
 	}
 }
 
+/*!
+	@brief Toggle the Tearing Effect output line (TE pin)
+	@param teMode true V-Blank pulses on TE pin, false TE output off
+	@note Used with frame_scheduler TearSyncGpioBegin to start flushes in V-Blank
+*/
+void ST7789_TFT ::TFTtearingEffect(bool teMode){
+	if( teMode) {
+		writeCommand(ST7789_TEON);
+		writeData(0x00); // TEM = 0, V-Blank information only
+	} else {
+		writeCommand(ST7789_TEOFF);
+	}
+}
+
 /*!
 	@brief Toggle the sleep mode
 	@param sleepMode true sleep on false sleep off
@@ -42,8 +42,7 @@ void  TM1637plus_Model4::displayClear()
 */
 rdlib::Return_Codes_e TM1637plus_Model4::displayBegin(void)
 {
-	int GpioClockErrorstatus = 0;
-	int GpioDataErrorstatus = 0;
+	int GpioBusErrorstatus = 0;
 
 	// open /dev/gpiochipX
 	_GpioHandle = Display_OPEN_GPIO_CHIP; 
@@ -53,20 +52,15 @@ rdlib::Return_Codes_e TM1637plus_Model4::displayBegin(void)
 		return rdlib::GpioChipDevice;
 	}
 
-	// Clain GPIO
-	GpioClockErrorstatus = Display_SCLK_SetDigitalInput;
-	GpioDataErrorstatus = Display_SDATA_SetDigitalInput;
-	if (GpioClockErrorstatus < 0 )
+	// Claim GPIO as open drain outputs, released (high) when idle
+	GpioBusErrorstatus = _bus.claim(_GpioHandle, _Display_SCLK, _Display_SDATA, LG_SET_OPEN_DRAIN, true);
+	if (GpioBusErrorstatus < 0 )
 	{
-		fprintf(stderr,"Error : Can't claim CLK GPIO for input (%s)\n", lguErrorText(GpioClockErrorstatus));
-		return rdlib::GpioPinClaim;
-	}
-	if (GpioDataErrorstatus < 0 )
-	{
-		fprintf(stderr, "Error : Can't claim DATA GPIO for input (%s)\n", lguErrorText(GpioDataErrorstatus));
+		fprintf(stderr,"Error : Can't claim CLK and DATA GPIO for open drain output (%s)\n", lguErrorText(GpioBusErrorstatus));
 		return rdlib::GpioPinClaim;
 	}
 
+	invalidateShadow();
 	return rdlib::Success;
 }
 
@@ -82,6 +76,17 @@ void TM1637plus_Model4::setBrightness(uint8_t brightness, bool on)
 	_brightness = (brightness & 0x7) | (on? 0x08 : 0x00);
 }
 
+/*!
+	@brief Forget the shadow copy of the display RAM
+	@details setSegments skips digits and the brightness command when they are already on the display.
+		Call this if the module was power cycled, the next write of each digit is sent.
+*/
+void TM1637plus_Model4::invalidateShadow(void)
+{
+	_displayRAM.invalidate();
+	_brightnessSent = 0xFF;
+}
+
 /*!
 	@brief Display data on the module
 	@details This function receives segment values as input and displays them. The segment data
@@ -93,26 +98,37 @@ void TM1637plus_Model4::setBrightness(uint8_t brightness, bool on)
 	@param segments An array of size length containing the raw segment values
 	@param length The number of digits to be modified
 	@param position The position from which to start the modification (0 - leftmost, 3 - rightmost)
+	@note Only digits that changed are written, a run of them in one auto increment burst.
+		The brightness command is sent when the brightness changed.
 */
 void TM1637plus_Model4::setSegments(const uint8_t segments[], uint8_t length, uint8_t position)
 {
-	// Write Command 1
-	CommStart();
-	writeByte(TM1637_COMMAND_1);
-	CommStop();
-
-	// Write Command 2 + first digit address
-	CommStart();
-	writeByte(TM1637_COMMAND_2 + (position & 0x03));
-	// Write the data
 	for (uint8_t i=0; i < length; i++)
-		writeByte(segments[i]);
-	CommStop();
+		_displayRAM.stage(position + i, segments[i]);
 
+	_displayRAM.commit(_ShadowMaxGap, [this](size_t first, std::span<const uint8_t> data)
+	{
+		// Write Command 1
+		CommStart();
+		writeByte(TM1637_COMMAND_1);
+		CommStop();
+
+		// Write Command 2 + first digit address
+		CommStart();
+		writeByte(TM1637_COMMAND_2 + first);
+		// Write the data
+		for (uint8_t value : data)
+			writeByte(value);
+		CommStop();
+		return true;
+	});
+
+	if (_brightnessSent == (_brightness & 0x0F)) return;
 	// Write Command 3 + brightness
 	CommStart();
 	writeByte(TM1637_COMMAND_3 + (_brightness & 0x0F));
 	CommStop();
+	_brightnessSent = _brightness & 0x0F;
 }
 
 
@@ -242,14 +258,22 @@ rdlib::Return_Codes_e  TM1637plus_Model4::DisplayString(const char* numStr, uint
 	@param digit An ASCII character
 	@return A code representing the 7 segment image of the digit (LSB - segment A;
 			bit 6 - segment G; bit 7 - always zero) from the font.
+			0 (blank) if the character is outside the font.
 */
 unsigned char TM1637plus_Model4::encodeCharacter(unsigned char digit)
 {
+	if (digit < _ASCIIOffset || digit >= _ASCIIEnd) return 0;
 	const uint8_t *font = SevenSegmentFont::pFontSevenSegptr();
 	unsigned char ascii = font[digit- _ASCIIOffset];
 	return ascii;
 }
 
+/*!
+	@brief Get the number of digits of the display
+	@return DisplaySize as passed to the constructor
+*/
+uint8_t TM1637plus_Model4::getDisplaySize(void) const {return _DisplaySize;}
+
 /*!
 	@brief Close method , frees GPIO and deactivate display.
 	@return 
@@ -262,21 +286,14 @@ rdlib::Return_Codes_e TM1637plus_Model4::displayClose(void)
 {
 	uint8_t ErrorFlag = 0; // Becomes > 0 in event of error
 
-	int GpioClockErrorstatus = 0;
-	int GpioDataErrorstatus = 0;
+	int GpioBusErrorstatus = 0;
 	int GpioCloseStatus = 0;
 
-	GpioClockErrorstatus =  Display_GPIO_FREE_CLK;
-	GpioDataErrorstatus =   Display_GPIO_FREE_SDATA;
+	GpioBusErrorstatus =  _bus.release();
 
-	if (GpioClockErrorstatus < 0 )
-	{
-		fprintf(stderr,"Error :: Can't Free CLK GPIO  (%s)\n", lguErrorText(GpioClockErrorstatus));
-		ErrorFlag = 2;
-	}
-	if (GpioDataErrorstatus < 0 )
+	if (GpioBusErrorstatus < 0 )
 	{
-		fprintf(stderr, "Error :: Can't free DATA GPIO (%s)\n", lguErrorText(GpioDataErrorstatus));
+		fprintf(stderr,"Error :: Can't Free CLK and DATA GPIO  (%s)\n", lguErrorText(GpioBusErrorstatus));
 		ErrorFlag = 2;
 	}
 
@@ -302,10 +319,12 @@ rdlib::Return_Codes_e TM1637plus_Model4::displayClose(void)
 /*!
 	@brief Sets the delay, in microseconds, between bit transition on the serial
 		bus connected to the display
+	@note Delays up to bitbang_delay::SpinLimitMicroSec busy-wait, longer ones sleep.
 */
 void TM1637plus_Model4::CommBitDelay(void)
 {
-	delayMicroSecRDL(_BitDelayUS);
+	if (_BitDelayUS > 0)
+		bitbang_delay::delayMicroSec(static_cast<uint32_t>(_BitDelayUS));
 }
 
 /*! 
@@ -313,12 +332,7 @@ void TM1637plus_Model4::CommBitDelay(void)
 */
 void TM1637plus_Model4::CommStart(void)
 {
-	int GpioDataErrorstatus = 0;
-	GpioDataErrorstatus = Display_SDATA_SetDigitalOutput;
-	if (GpioDataErrorstatus < 0 )
-	{
-		fprintf(stderr, "Error : Can't claim DATA GPIO for output (%s)\n", lguErrorText(GpioDataErrorstatus));
-	}
+	_bus.setData(false);
 	CommBitDelay();
 }
 
@@ -327,28 +341,11 @@ void TM1637plus_Model4::CommStart(void)
 */
 void TM1637plus_Model4::CommStop(void)
 {
-	int GpioDataErrorstatus = 0;
-	int GpioClockErrorstatus = 0;
-	
-	GpioDataErrorstatus = Display_SDATA_SetDigitalOutput;
-	if (GpioDataErrorstatus < 0 )
-	{
-		fprintf(stderr, "Error : Can't claim DATA GPIO for output (%s)\n", lguErrorText(GpioDataErrorstatus));
-	}
+	_bus.setData(false);
 	CommBitDelay();
-
-	GpioClockErrorstatus = Display_SCLK_SetDigitalInput;
-	if (GpioClockErrorstatus < 0 )
-	{
-		fprintf(stderr,"Error : Can't claim CLK GPIO for input (%s)\n", lguErrorText(GpioClockErrorstatus));
-	}
+	_bus.setClock(true);
 	CommBitDelay();
-
-	GpioDataErrorstatus = Display_SDATA_SetDigitalInput;
-	if (GpioDataErrorstatus < 0 )
-	{
-		fprintf(stderr, "Error : Can't claim DATA GPIO for input (%s)\n", lguErrorText(GpioDataErrorstatus));
-	}
+	_bus.setData(true);
 	CommBitDelay();
 }
 
@@ -356,92 +353,39 @@ void TM1637plus_Model4::CommStop(void)
 	@brief Writes a byte to the Display
 	@param byte the Byte to write
 	@return status of acknowledge bit
+	@note The lines are open drain, a level of 1 releases the line to the pull-up.
 */
 bool TM1637plus_Model4::writeByte(uint8_t byte)
 {
 	uint8_t data = byte;
-	int GpioDataErrorstatus = 0;
-	int GpioClockErrorstatus = 0;
 
 	// 8 Data Bits
 	for(uint8_t i = 0; i < 8; i++) 
 	{
-		// Set clock low
-		GpioClockErrorstatus = Display_SCLK_SetDigitalOutput;
-		if (GpioClockErrorstatus < 0 )
-		{
-			fprintf(stderr,"Error : Can't claim CLK GPIO for output (%s)\n", lguErrorText(GpioClockErrorstatus));
-		}
+		_bus.setClock(false);
 		CommBitDelay();
-
-		// Set data bit
-		if (data & 0x01)
-		{
-			GpioDataErrorstatus = Display_SDATA_SetDigitalInput;
-			if (GpioDataErrorstatus < 0 )
-			{
-				fprintf(stderr, "Error : Can't claim DATA GPIO for input (%s)\n", lguErrorText(GpioDataErrorstatus));
-			}
-		}
-		else
-		{
-			GpioDataErrorstatus = Display_SDATA_SetDigitalOutput;
-			if (GpioDataErrorstatus < 0 )
-			{
-				fprintf(stderr, "Error : Can't claim DATA GPIO for output (%s)\n", lguErrorText(GpioDataErrorstatus));
-			}
-		}
-
+		_bus.setData(data & 0x01);
 		CommBitDelay();
-
-		// Set Clock high
-		GpioClockErrorstatus = Display_SCLK_SetDigitalInput;
-		if (GpioClockErrorstatus < 0 )
-		{
-			fprintf(stderr,"Error : Can't claim CLK GPIO for input (%s)\n", lguErrorText(GpioClockErrorstatus));
-		}
+		_bus.setClock(true);
 		CommBitDelay();
 		data = data >> 1;
 	}
 
-	// Wait for acknowledge
-	// Set Clock to Low
-	GpioClockErrorstatus = Display_SCLK_SetDigitalOutput;
-	if (GpioClockErrorstatus < 0 )
-	{
-		fprintf(stderr,"Error : Can't claim CLK GPIO for output (%s)\n", lguErrorText(GpioClockErrorstatus));
-	}
-	GpioDataErrorstatus = Display_SDATA_SetDigitalInput;
-	if (GpioDataErrorstatus < 0 )
-	{
-		fprintf(stderr, "Error : Can't claim DATA GPIO for input (%s)\n", lguErrorText(GpioDataErrorstatus));
-	}
+	// Wait for acknowledge, clock low and release data
+	_bus.setClock(false);
+	_bus.setData(true);
 	CommBitDelay();
-
-	// Set clock to high
-	GpioClockErrorstatus = Display_SCLK_SetDigitalInput;
-	if (GpioClockErrorstatus < 0 )
-	{
-		fprintf(stderr,"Error : Can't claim CLK GPIO for input (%s)\n", lguErrorText(GpioClockErrorstatus));
-	}
+	_bus.setClock(true);
 	CommBitDelay();
 
-	uint8_t acknowledge = Display_SDATA_Read;
+	uint8_t acknowledge = _bus.readData();
 	if (acknowledge == 0)
 	{
-		GpioDataErrorstatus = Display_SDATA_SetDigitalOutput;
-		if (GpioDataErrorstatus < 0 )
-		{
-			fprintf(stderr, "Error : Can't claim DATA GPIO for output (%s)\n", lguErrorText(GpioDataErrorstatus));
-		}
+		_bus.setData(false);
 	}
 	CommBitDelay();
 
-	GpioClockErrorstatus = Display_SCLK_SetDigitalOutput;
-	if (GpioClockErrorstatus < 0 )
-	{
-		fprintf(stderr,"Error : Can't claim CLK GPIO for output (%s)\n", lguErrorText(GpioClockErrorstatus));
-	}
+	_bus.setClock(false);
 	CommBitDelay();
 
 	return acknowledge;
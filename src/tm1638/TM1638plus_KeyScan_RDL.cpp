@@ -0,0 +1,326 @@
+/*!
+	@file     TM1638plus_KeyScan_RDL.cpp
+	@author   Gavin Lyons
+	@brief    RPI library Tm1638plus, Source file for the background key scanner of the TM1638 modules.
+*/
+
+#include "../../include/tm1638/TM1638plus_KeyScan_RDL.hpp"
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+/*!
+	@brief Constructor for a key scanner of a Model 1 or Model 3 module, 8 keys
+	@param display The module, displayBegin must be called before start()
+	@param capacity Number of events the queue holds, rounded up to a power of 2, minimum 2
+*/
+TM1638plus_KeyScan::TM1638plus_KeyScan(TM1638plus_Model1& display, size_t capacity)
+	: TM1638plus_KeyScan([&display]() -> uint16_t {return display.readButtons();}, 8, capacity)
+{
+}
+
+/*!
+	@brief Constructor for a key scanner of a Model 2 module, 16 keys
+	@param display The module, displayBegin must be called before start()
+	@param capacity Number of events the queue holds, rounded up to a power of 2, minimum 2
+*/
+TM1638plus_KeyScan::TM1638plus_KeyScan(TM1638plus_Model2& display, size_t capacity)
+	: TM1638plus_KeyScan([&display]() -> uint16_t {return display.ReadKey16Two();}, 16, capacity)
+{
+}
+
+/// @cond
+TM1638plus_KeyScan::TM1638plus_KeyScan(std::function<uint16_t(void)> readKeys, uint8_t numKeys, size_t capacity)
+	: _readKeys(std::move(readKeys)), _numKeys(numKeys)
+{
+	size_t size = 2;
+	while (size < capacity) size <<= 1;
+	_events = std::make_unique<KeyEvent_t[]>(size);
+	_mask = size - 1;
+	_eventFd = eventfd(0, EFD_SEMAPHORE | EFD_NONBLOCK | EFD_CLOEXEC);
+	if (_eventFd < 0)
+		fprintf(stderr, "Error: TM1638plus_KeyScan: Cannot create eventfd, getEventFd not available\n");
+}
+/// @endcond
+
+/*!
+	@brief Destructor for class TM1638plus_KeyScan, stops the scanner thread
+*/
+TM1638plus_KeyScan::~TM1638plus_KeyScan()
+{
+	stop();
+	if (_eventFd >= 0) close(_eventFd);
+}
+
+/*!
+	@brief Start the scanner thread
+	@return
+		-# rdlib::Success
+		-# rdlib::GenericError already running
+	@note From now until stop() the module must only be used through post().
+*/
+rdlib::Return_Codes_e TM1638plus_KeyScan::start(void)
+{
+	if (_running.exchange(true))
+	{
+		fprintf(stderr, "Error: TM1638plus_KeyScan start: Scanner thread already running\n");
+		return rdlib::GenericError;
+	}
+	_stableKeys = 0;
+	_longSent = 0;
+	for (uint8_t key = 0; key < MaxKeys; key++) _changeCount[key] = 0;
+	_keys.store(0);
+	_startTime = ScanClock_t::now();
+	_thread = std::thread(&TM1638plus_KeyScan::scanThread, this);
+	return rdlib::Success;
+}
+
+/*!
+	@brief Stop the scanner thread after it has run all posted display writes
+*/
+void TM1638plus_KeyScan::stop(void)
+{
+	{
+		// under the lock, so no post() can queue a write after the last runPosted()
+		std::lock_guard<std::mutex> lock(_postMutex);
+		if (!_running.exchange(false)) return;
+		_wake = true;
+	}
+	_postCond.notify_one();
+	if (_thread.joinable()) _thread.join();
+}
+
+/*!
+	@brief Is the scanner thread running
+	@return true if running
+*/
+bool TM1638plus_KeyScan::isRunning(void) const {return _running.load();}
+
+/*!
+	@brief Set the time between key reads
+	@param periodMs 1 to 1000 mS, default 10
+	@return
+		-# rdlib::Success
+		-# rdlib::GenericError running or out of range
+	@note Each read holds the bus for 4 bytes, display writes posted during a read wait for it.
+*/
+rdlib::Return_Codes_e TM1638plus_KeyScan::setScanPeriod(uint16_t periodMs)
+{
+	if (_running.load() || periodMs == 0 || periodMs > 1000)
+	{
+		fprintf(stderr, "Error: TM1638plus_KeyScan setScanPeriod: Running or period out of range 1-1000 : %u\n", periodMs);
+		return rdlib::GenericError;
+	}
+	_scanPeriodMs = periodMs;
+	return rdlib::Success;
+}
+
+/*!
+	@brief Set the software debounce
+	@param samples number of equal key reads in a row needed to accept a change, 1 is no debounce, default 3
+	@return
+		-# rdlib::Success
+		-# rdlib::GenericError running or 0
+	@note Debounce time is samples times the scan period, 30 mS by default.
+*/
+rdlib::Return_Codes_e TM1638plus_KeyScan::setDebounce(uint8_t samples)
+{
+	if (_running.load() || samples == 0)
+	{
+		fprintf(stderr, "Error: TM1638plus_KeyScan setDebounce: Running or samples is 0\n");
+		return rdlib::GenericError;
+	}
+	_debounceSamples = samples;
+	return rdlib::Success;
+}
+
+/*!
+	@brief Set the hold time of a long press
+	@param longPressMs hold time in mS for a LongPress event, 0 for no LongPress events, default 1000
+	@return
+		-# rdlib::Success
+		-# rdlib::GenericError running
+*/
+rdlib::Return_Codes_e TM1638plus_KeyScan::setLongPress(uint16_t longPressMs)
+{
+	if (_running.load())
+	{
+		fprintf(stderr, "Error: TM1638plus_KeyScan setLongPress: Running\n");
+		return rdlib::GenericError;
+	}
+	_longPressMs = longPressMs;
+	return rdlib::Success;
+}
+
+/*!
+	@brief Queue a display write to run on the scanner thread
+	@param func function doing the write, e.g. a lambda calling displayText on the module
+	@return rdlib::Success, or rdlib::GenericError if scanner thread is not running or func is empty
+	@details Posted writes run in order, before the next key read.
+*/
+rdlib::Return_Codes_e TM1638plus_KeyScan::post(DisplayFunc_t func)
+{
+	if (!func) return rdlib::GenericError;
+	{
+		std::lock_guard<std::mutex> lock(_postMutex);
+		if (!_running.load()) return rdlib::GenericError;
+		_posted.push_back(std::move(func));
+		_wake = true;
+	}
+	_postCond.notify_one();
+	return rdlib::Success;
+}
+
+/*!
+	@brief Take the next key event from the queue, does not block
+	@param event the event, unchanged if none
+	@return true if an event was taken
+	@note Call from one thread only.
+*/
+bool TM1638plus_KeyScan::getEvent(KeyEvent_t& event)
+{
+	size_t tail = _tail.load(std::memory_order_relaxed);
+	if (tail == _head.load(std::memory_order_acquire)) return false;
+	event = _events[tail & _mask];
+	_tail.store(tail + 1, std::memory_order_release);
+	if (_eventFd >= 0)
+	{
+		uint64_t count = 0;
+		[[maybe_unused]] ssize_t bytes = read(_eventFd, &count, sizeof(count));
+	}
+	return true;
+}
+
+/*!
+	@brief Wait for the next key event
+	@param event the event, unchanged if none
+	@param timeoutMs most mS to wait, -1 waits forever
+	@return true if an event was taken, false on timeout
+	@note Call from one thread only.
+*/
+bool TM1638plus_KeyScan::waitEvent(KeyEvent_t& event, int timeoutMs)
+{
+	if (getEvent(event)) return true;
+	if (_eventFd < 0) return false;
+	struct pollfd pfd = {_eventFd, POLLIN, 0};
+	if (poll(&pfd, 1, timeoutMs) <= 0) return false;
+	return getEvent(event);
+}
+
+/*!
+	@brief Get the eventfd of the event queue
+	@return file descriptor, readable while events are queued, -1 if not available
+	@details Add it to poll or epoll, on POLLIN call getEvent until it returns false.
+		Do not read the descriptor, getEvent does that.
+*/
+int TM1638plus_KeyScan::getEventFd(void) const {return _eventFd;}
+
+/*!
+	@brief Get the debounced state of the keys
+	@return bit mask, bit 0 is key 1 (S1)
+*/
+uint16_t TM1638plus_KeyScan::getKeys(void) const {return _keys.load();}
+
+/*!
+	@brief Get the number of events lost because the queue was full
+	@return number of events
+*/
+uint32_t TM1638plus_KeyScan::getDroppedCount(void) const {return _droppedCount.load();}
+
+/// @cond
+
+// Single producer push, scanner thread, false and counted if full
+bool TM1638plus_KeyScan::pushEvent(uint8_t key, KeyEvent_e type)
+{
+	size_t head = _head.load(std::memory_order_relaxed);
+	if (head - _tail.load(std::memory_order_acquire) > _mask)
+	{
+		_droppedCount.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+	KeyEvent_t& event = _events[head & _mask];
+	event.key = key + 1;
+	event.event = type;
+	event.timeMs = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(ScanClock_t::now() - _startTime).count());
+	// count the event before publishing it, so every getEvent finds its count to take
+	if (_eventFd >= 0)
+	{
+		uint64_t one = 1;
+		[[maybe_unused]] ssize_t bytes = write(_eventFd, &one, sizeof(one));
+	}
+	_head.store(head + 1, std::memory_order_release);
+	return true;
+}
+
+// Accept a key change after _debounceSamples equal reads, send LongPress once per press
+void TM1638plus_KeyScan::debounce(uint16_t raw)
+{
+	const uint32_t nowMs = static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::milliseconds>(ScanClock_t::now() - _startTime).count());
+	for (uint8_t key = 0; key < _numKeys; key++)
+	{
+		const uint16_t bit = 1U << key;
+		if ((raw & bit) != (_stableKeys & bit))
+		{
+			if (++_changeCount[key] >= _debounceSamples)
+			{
+				_changeCount[key] = 0;
+				_stableKeys ^= bit;
+				if (_stableKeys & bit)
+				{
+					_pressTimeMs[key] = nowMs;
+					_longSent &= ~bit;
+					pushEvent(key, KeyEvent_e::Press);
+				} else
+				{
+					pushEvent(key, KeyEvent_e::Release);
+				}
+			}
+		} else
+		{
+			_changeCount[key] = 0;
+		}
+		if ((_stableKeys & bit) && !(_longSent & bit) && _longPressMs > 0 && nowMs - _pressTimeMs[key] >= _longPressMs)
+		{
+			_longSent |= bit;
+			pushEvent(key, KeyEvent_e::LongPress);
+		}
+	}
+	_keys.store(_stableKeys);
+}
+
+// Run the posted display writes, outside the lock so post() never waits on the bus
+void TM1638plus_KeyScan::runPosted(void)
+{
+	std::vector<DisplayFunc_t> posted;
+	{
+		std::lock_guard<std::mutex> lock(_postMutex);
+		posted.swap(_posted);
+		_wake = false;
+	}
+	for (auto& func : posted) func();
+}
+
+// Scanner thread, owns the bus, reads keys every scan period and runs posted writes between reads
+void TM1638plus_KeyScan::scanThread(void)
+{
+	const auto period = std::chrono::milliseconds(_scanPeriodMs);
+	auto nextScan = ScanClock_t::now();
+	while (_running.load())
+	{
+		runPosted();
+		auto now = ScanClock_t::now();
+		if (now >= nextScan)
+		{
+			debounce(_readKeys());
+			nextScan += period;
+			if (nextScan < now) nextScan = now + period; // fell behind, do not catch up with a burst of reads
+		}
+		std::unique_lock<std::mutex> lock(_postMutex);
+		_postCond.wait_until(lock, nextScan, [this]{return _wake;});
+	}
+	runPosted();
+}
+
+/// @endcond
+
+// **************** EOF *****************
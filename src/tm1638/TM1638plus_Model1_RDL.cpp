@@ -29,17 +29,14 @@ TM1638plus_Model1::TM1638plus_Model1(uint8_t strobe, uint8_t clock, uint8_t data
 rdlib::Return_Codes_e TM1638plus_Model1::setLED(uint8_t position, uint8_t value)
 {
 	int GpioDataErrorstatus = 0;
-	GpioDataErrorstatus = Display_SDATA_SetDigitalOutput;
+	GpioDataErrorstatus = _bus.setDataOutput();
 	if (GpioDataErrorstatus < 0 )
 	{
 		fprintf(stderr, "Error : Can't claim DATA GPIO for output (%s)\n", lguErrorText(GpioDataErrorstatus));
 		return rdlib::GpioPinClaim;
 	}
-	sendCommand(TM_WRITE_LOC);
-	Display_CS_SetLow;
-	sendData(TM_LEDS_ADR + (position << 1));
-	sendData(value);
-	Display_CS_SetHigh;
+	_displayRAM.stage((TM_LEDS_ADR - TM_SEG_ADR) + (position << 1), value);
+	writeDisplayRAM();
 	return rdlib::Success;
 }
 
@@ -50,6 +47,7 @@ rdlib::Return_Codes_e TM1638plus_Model1::setLED(uint8_t position, uint8_t value)
 		-# Upper byte ignored this byte/method is used by sub-class Model 3 
 		-# Lower byte LED data model 1
 		-# setLEDs(0xF0) Displays as XXXX LLLL (L1-L8),NOTE on display L8 is on right hand side.
+	@note The LEDs that changed are written in one burst.
 */
 void TM1638plus_Model1::setLEDs(uint16_t ledvalues)
 {
@@ -59,9 +57,10 @@ void TM1638plus_Model1::setLEDs(uint16_t ledvalues)
 		if ((ledvalues & (1 << LEDposition)) != 0) {
 			colour |= 0x01; 
 		} 
-		setLED(LEDposition, colour);
+		_displayRAM.stage((TM_LEDS_ADR - TM_SEG_ADR) + (LEDposition << 1), colour);
 		colour = 0;
 	}
+	commitFrame();
 }
 
 /*!
@@ -127,6 +126,7 @@ void TM1638plus_Model1::DisplayDecNumNibble(uint16_t  numberUpper, uint16_t numb
 	@note 
 		Dots are removed from string and dot on preceding digit switched on
 		"abc.def" will be shown as "abcdef" with c decimal point turned on.
+		Only digits that changed are written, in one burst.
 */
 rdlib::Return_Codes_e TM1638plus_Model1::displayText(const char *text) {
 	// Check for null pointer
@@ -135,17 +135,19 @@ rdlib::Return_Codes_e TM1638plus_Model1::displayText(const char *text) {
 		fprintf(stderr ,"Error: displayText 1: String is a null pointer.\n");
 		return rdlib::CharArrayNullptr;
 	}
+	const uint8_t *font = SevenSegmentFont::pFontSevenSegptr();
 	char c, pos;
 	pos = 0;
 		while ((c = (*text++)) && pos < _TMDisplaySize)
 		{
 			if (*text == '.' && c != '.') {
-				displayASCIIwDot(pos++, c);
+				_displayRAM.stage(pos++ << 1, font[static_cast<uint8_t>(c) - TM_ASCII_OFFSET] + TM_DOT_MASK_DEC);
 				text++;
 			}else{
-				displayASCII(pos++, c);
+				_displayRAM.stage(pos++ << 1, font[static_cast<uint8_t>(c) - TM_ASCII_OFFSET]);
 			}
 		}
+	commitFrame();
 	return rdlib::Success;
 }
 
@@ -164,14 +166,25 @@ void TM1638plus_Model1::displayASCIIwDot(uint8_t position, uint8_t ascii) {
 	@brief  Send seven segment value to seven segment
 	@param position The position on display 0-7  
 	@param value  byte of data corresponding to segments (dp)gfedcba 
-	@note 	0b01000001 in value will set g and a on.
+	@note 	0b01000001 in value will set g and a on. Not written if already on display.
 */
 void TM1638plus_Model1::display7Seg(uint8_t position, uint8_t value) { // call 7-segment
-	sendCommand(TM_WRITE_LOC);
-	Display_CS_SetLow;
-	sendData(TM_SEG_ADR + (position << 1));
-	sendData(value);
-	Display_CS_SetHigh;
+	_displayRAM.stage(position << 1, value);
+	writeDisplayRAM();
+}
+
+/*!
+	@brief  Send seven segment values to a run of digits
+	@param segments An array of size length, bytes of data corresponding to segments (dp)gfedcba
+	@param length The number of digits to set
+	@param position The position of the first digit 0-7, 0 is leftmost
+	@note Only digits that changed are written, in one burst.
+*/
+void TM1638plus_Model1::setSegments(const uint8_t segments[], uint8_t length, uint8_t position)
+{
+	for (uint8_t i = 0; i < length && position + i < _TMDisplaySize; i++)
+		_displayRAM.stage((position + i) << 1, segments[i]);
+	commitFrame();
 }
 
 /*!
@@ -228,7 +241,7 @@ uint8_t TM1638plus_Model1::readButtons()
 
 	Display_CS_SetLow;
 	sendData(TM_BUTTONS_MODE); 
-	GpioDataErrorstatus = Display_SDATA_SetDigitalInput;
+	GpioDataErrorstatus = _bus.setDataInput();
 	if (GpioDataErrorstatus < 0 )
 	{
 		fprintf(stderr, "Error : Can't claim DATA GPIO for input (%s)\n", lguErrorText(GpioDataErrorstatus));
@@ -239,7 +252,7 @@ uint8_t TM1638plus_Model1::readButtons()
 		buttons |= v;
 	}
 
-	GpioDataErrorstatus = Display_SDATA_SetDigitalOutput;
+	GpioDataErrorstatus = _bus.setDataOutput();
 	if (GpioDataErrorstatus < 0 )
 	{
 		fprintf(stderr, "Error : Can't claim DATA GPIO for output (%s)\n", lguErrorText(GpioDataErrorstatus));
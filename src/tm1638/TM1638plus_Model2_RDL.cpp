@@ -29,8 +29,20 @@ TM1638plus_Model2::TM1638plus_Model2(uint8_t strobe, uint8_t clock, uint8_t data
 	@note
 		for segment parameter a is 0 , dp is 7 , segment Value is which segments are off or on for each digit.
 		To to set all "a" on send (0x00,0xFF). To set all segment "g" off (0x06,0X00)
+		Not written if already on display.
 */
 void TM1638plus_Model2::DisplaySegments(uint8_t segment, uint8_t digit)
+{
+	stageSegments(segment, digit);
+	writeDisplayRAM();
+}
+
+/*!
+	@brief Stage a seven segment value for the next writeDisplayRAM
+	@param segment 0-7 segment abcdefg(dp)
+	@param digit display digit bits, d8d7d6d5d54d3d2d1.
+*/
+void TM1638plus_Model2::stageSegments(uint8_t segment, uint8_t digit)
 {
 	 if (_SWAP_NIBBLES == true)
 	 {
@@ -41,11 +53,7 @@ void TM1638plus_Model2::DisplaySegments(uint8_t segment, uint8_t digit)
 	 }
 
 	segment = (segment<<1);
-	sendCommand(TM_WRITE_LOC);
-	Display_CS_SetLow;
-	sendData(TM_SEG_ADR | segment);
-	sendData(digit);
-	Display_CS_SetHigh;
+	_displayRAM.stage(segment, digit);
 }
 
 
@@ -192,6 +200,7 @@ rdlib::Return_Codes_e TM1638plus_Model2::DisplayStr(const char* string, uint16_t
 	The bits are  mapping below abcdefg(dp) = 01234567 ! .
 	See for mapping of seven segment to digit https://en.wikipedia.org/wiki/Seven-segment_display
 	We have to do this as TM1638 model 2 is addressed by segment not digit unlike Model 1&3
+	The segments that changed are written in one burst.
 */
 void TM1638plus_Model2::ASCIItoSegment(const uint8_t values[])
 {
@@ -200,8 +209,9 @@ void TM1638plus_Model2::ASCIItoSegment(const uint8_t values[])
 	for (uint8_t  j = 0; j < _TMDisplaySize; j++) {
 		SegmentValue |= ((values[j] >> segment) & 1) << (_TMDisplaySize - j - 1);
 	}
-	DisplaySegments(segment , SegmentValue);
+	stageSegments(segment , SegmentValue);
 	}
+	commitFrame();
 }
 
 /*!
@@ -216,7 +226,7 @@ unsigned char TM1638plus_Model2::ReadKey16()
 	int GpioDataErrorstatus = 0;
 	Display_CS_SetLow;
 	sendData(TM_BUTTONS_MODE);
-	GpioDataErrorstatus = Display_SDATA_SetDigitalInput;
+	GpioDataErrorstatus = _bus.setDataInput();
 	if (GpioDataErrorstatus < 0 )
 	{
 		fprintf(stderr, "Error : Can't claim DATA GPIO for input (%s)\n", lguErrorText(GpioDataErrorstatus));
@@ -231,7 +241,7 @@ unsigned char TM1638plus_Model2::ReadKey16()
 		if (c[i] == 0x02) key_value = 9 + (2*i); //00000010 2 0x02
 		if (c[i] == 0x20) key_value = 10 + (2*i);  //00100000 32 0x20
 	}
-	GpioDataErrorstatus = Display_SDATA_SetDigitalOutput;
+	GpioDataErrorstatus = _bus.setDataOutput();
 	if (GpioDataErrorstatus < 0 )
 	{
 		fprintf(stderr, "Error : Can't claim DATA GPIO for output (%s)\n", lguErrorText(GpioDataErrorstatus));
@@ -265,7 +275,7 @@ uint16_t TM1638plus_Model2::ReadKey16Two()
 	int GpioDataErrorstatus = 0;
 	Display_CS_SetLow;
 	sendData(TM_BUTTONS_MODE);
-	GpioDataErrorstatus = Display_SDATA_SetDigitalInput;
+	GpioDataErrorstatus = _bus.setDataInput();
 	if (GpioDataErrorstatus < 0 )
 	{
 		fprintf(stderr, "Can't claim DATA GPIO for input (%s)\n", lguErrorText(GpioDataErrorstatus));
@@ -280,7 +290,7 @@ uint16_t TM1638plus_Model2::ReadKey16Two()
 		 // key_value =  16,15,14,13,12,11,10,9,8,7,6,5,4,3,2,1.
 		key_value |= ((Datain & 0x000F) << (2*i)) | (((Datain & 0x00F0) << 4) << (2*i));
 	}
-	GpioDataErrorstatus = Display_SDATA_SetDigitalOutput;
+	GpioDataErrorstatus = _bus.setDataOutput();
 	if (GpioDataErrorstatus < 0 )
 	{
 		fprintf(stderr, "Can't claim DATA GPIO for output (%s)\n", lguErrorText(GpioDataErrorstatus));
@@ -28,17 +28,14 @@ TM1638plus_Model3::TM1638plus_Model3(uint8_t strobe, uint8_t clock, uint8_t data
 rdlib::Return_Codes_e  TM1638plus_Model3::setLED(uint8_t position, uint8_t value)
 {
 	int GpioDataErrorstatus = 0;
-	GpioDataErrorstatus = Display_SDATA_SetDigitalOutput;
+	GpioDataErrorstatus = _bus.setDataOutput();
 	if (GpioDataErrorstatus < 0 )
 	{
 		fprintf(stderr, "Error : Can't claim DATA GPIO for output (%s)\n", lguErrorText(GpioDataErrorstatus));
 		return rdlib::GpioPinClaim;
 	}
-	sendCommand(TM_WRITE_LOC);
-	Display_CS_SetLow;
-	sendData(TM_LEDS_ADR + (position << 1));
-	sendData(value);
-	Display_CS_SetHigh;
+	_displayRAM.stage((TM_LEDS_ADR - TM_SEG_ADR) + (position << 1), value);
+	writeDisplayRAM();
 	return rdlib::Success;
 }
 
@@ -48,6 +45,7 @@ rdlib::Return_Codes_e  TM1638plus_Model3::setLED(uint8_t position, uint8_t value
 		MSB uint8_t for the green LEDs, LSB uint8_t for the red LEDs (0xgreenred) 
 		ie. 0xE007   1110 0000 0000 0111 results in L8-L1  GGGX XRRR, NOTE L8 is RHS on display
 		setLEDs(0xFE01); // L1-L8 turns on RGGG GGGG on display L1-L8 as seen IRL
+	@note The LEDs that changed are written in one burst.
 */
 void TM1638plus_Model3::setLEDs(uint16_t ledvalues)
 {
@@ -62,6 +60,7 @@ void TM1638plus_Model3::setLEDs(uint16_t ledvalues)
 			colour |= TM_GREEN_LED; //scan upper uint8_t, set green if one
 		}
 
-		setLED(LEDposition, colour);
+		_displayRAM.stage((TM_LEDS_ADR - TM_SEG_ADR) + (LEDposition << 1), colour);
 	}
+	commitFrame();
 }
@@ -26,14 +26,70 @@ TM1638plus_common::TM1638plus_common(uint8_t strobe, uint8_t clock, uint8_t data
 	@note The display is cleared by writing zero to all data segment  addresses.
 */
 void TM1638plus_common::reset() {
+	for (uint8_t address = 0; address < _TMDisplayRAMSize; address++)
+	{
+		_displayRAM.stage(address, 0x00); //clear all segments
+	}
+	_displayRAM.invalidate(); // written in one burst whatever the shadow holds
+	commitFrame();
+}
+
+/*!
+	@brief Forget the shadow copy of the display RAM
+	@details Digit and LED writes are skipped when the value is already on the display.
+		Call this if the module was power cycled, the next write of each digit and LED is sent.
+*/
+void TM1638plus_common::invalidateShadow(void)
+{
+	_displayRAM.invalidate();
+}
+
+/*!
+	@brief Write the staged display RAM bytes that changed
+	@details Each run of changed addresses is sent as one auto increment burst,
+		one strobe for the command and one for address and data.
+		Used for single digit and LED writes.
+*/
+void TM1638plus_common::writeDisplayRAM(void)
+{
+	_displayRAM.commit(_TMShadowMaxGap, [this](size_t first, std::span<const uint8_t> data)
+	{
+		return sendBurst(first, data);
+	});
+}
+
+/*!
+	@brief Write the staged display RAM to the display in one auto increment burst
+	@details The burst runs from the first to the last changed address, unchanged addresses
+		in between are resent. After reset or invalidateShadow that is the whole 16 byte
+		display RAM image. Nothing is sent if nothing changed.
+	@note The numeric and text display functions and setLEDs call this.
+*/
+void TM1638plus_common::commitFrame(void)
+{
+	_displayRAM.commit(_TMDisplayRAMSize, [this](size_t first, std::span<const uint8_t> data)
+	{
+		return sendBurst(first, data);
+	});
+}
+
+/*!
+	@brief Send bytes to consecutive display RAM addresses
+	@param first first address, 0 is the leftmost digit
+	@param data bytes to send
+	@return true, the TM1638 bus has no acknowledge
+*/
+bool TM1638plus_common::sendBurst(size_t first, std::span<const uint8_t> data)
+{
 	sendCommand(TM_WRITE_INC); // set auto increment mode
 	Display_CS_SetLow;
-	sendData(TM_SEG_ADR);   // set starting address to 0
-	for (uint8_t position = 0; position < 16; position++)
+	sendData(TM_SEG_ADR + first);
+	for (uint8_t value : data)
 	{
-		sendData(0x00); //clear all segments
+		sendData(value);
 	}
 	Display_CS_SetHigh;
+	return true;
 }
 
 /*!
@@ -58,8 +114,7 @@ void TM1638plus_common::brightness(uint8_t brightness)
 rdlib::Return_Codes_e TM1638plus_common::displayBegin(void)
 {
 	int GpioStrobeErrorstatus = 0;
-	int GpioClockErrorstatus = 0;
-	int GpioDataErrorstatus = 0;
+	int GpioBusErrorstatus = 0;
 
 	_GpioHandle = Display_OPEN_GPIO_CHIP; // open /dev/gpiochipX
 	if ( _GpioHandle < 0)	// open error
@@ -70,22 +125,16 @@ rdlib::Return_Codes_e TM1638plus_common::displayBegin(void)
 
 	// Clain GPIO as outputs
 	GpioStrobeErrorstatus = Display_CS_SetDigitalOutput;
-	GpioClockErrorstatus = Display_SCLK_SetDigitalOutput;
-	GpioDataErrorstatus = Display_SDATA_SetDigitalOutput;
+	GpioBusErrorstatus = _bus.claim(_GpioHandle, _Display_SCLK, _Display_SDATA);
 
 	if (GpioStrobeErrorstatus < 0 )
 	{
 		fprintf(stderr,"Error : Can't claim STB GPIO for output (%s)\n", lguErrorText(GpioStrobeErrorstatus));
 		return rdlib::GpioPinClaim;
 	}
-	if (GpioClockErrorstatus < 0 )
-	{
-		fprintf(stderr,"Error : Can't claim CLK GPIO for output (%s)\n", lguErrorText(GpioClockErrorstatus));
-		return rdlib::GpioPinClaim;
-	}
-	if (GpioDataErrorstatus < 0 )
+	if (GpioBusErrorstatus < 0 )
 	{
-		fprintf(stderr, "Error : Can't claim DATA GPIO for output (%s)\n", lguErrorText(GpioDataErrorstatus));
+		fprintf(stderr,"Error : Can't claim CLK and DATA GPIO for output (%s)\n", lguErrorText(GpioBusErrorstatus));
 		return rdlib::GpioPinClaim;
 	}
 
@@ -119,41 +168,23 @@ void TM1638plus_common::sendData(uint8_t data)
 /*!
 	@brief Shifts in a byte of data from the Tm1638 SPI-like bus
 	@return  Data byte
-	@note _TMCommDelay microsecond delay may have to be adjusted depending on processor
+	@note _TMCommDelay microsecond delay may have to be adjusted depending on processor,
+		delays up to bitbang_delay::SpinLimitMicroSec busy-wait.
 */
 uint8_t  TM1638plus_common::HighFreqshiftin(void)
 {
-	uint8_t value = 0;
-	uint8_t i = 0;
-
-	for(i = 0; i < 8; ++i)
-	{
-		value |= (Display_SDATA_Read << i);
-		Display_SCLK_SetHigh;
-		delayMicroSecRDL(_TMCommDelay);
-		Display_SCLK_SetLow;
-		delayMicroSecRDL(_TMCommDelay);
-	}
-	return value;
+	return _bus.shiftIn(bitbang_bus::BitOrder_e::LSBFirst, _TMCommDelay);
 }
 
  /*!
 	@brief Shifts out a byte of data on to the Tm1638 SPI-like bus
 	@param val The byte of data to shift out
-	@note _TMCommDelay microsecond delay may have to be adjusted depending on processor
+	@note _TMCommDelay microsecond delay may have to be adjusted depending on processor,
+		delays up to bitbang_delay::SpinLimitMicroSec busy-wait.
 */
 void TM1638plus_common::HighFreqshiftOut(uint8_t val)
 {
-	uint8_t i;
-
-	for (i = 0; i < 8; i++)
-	{
-		!!(val & (1 << i)) ? Display_SDATA_SetHigh : Display_SDATA_SetLow;
-		Display_SCLK_SetHigh;
-		delayMicroSecRDL(_TMCommDelay);
-		Display_SCLK_SetLow;
-		delayMicroSecRDL(_TMCommDelay);
-	}
+	_bus.shiftOut(val, bitbang_bus::BitOrder_e::LSBFirst, _TMCommDelay);
 }
 
 /*!
@@ -162,6 +193,18 @@ void TM1638plus_common::HighFreqshiftOut(uint8_t val)
 */
 uint16_t TM1638plus_common::TMCommDelayGet(void){return  _TMCommDelay;}
 
+/*!
+	@brief Translate a single character into 7 segment code from the font
+	@param character An ASCII character, space to 'z'
+	@return 7 segment code (dp)gfedcba, decimal point off, 0 (blank) if the character is outside the font.
+*/
+unsigned char TM1638plus_common::encodeCharacter(unsigned char character)
+{
+	if (character < TM_ASCII_OFFSET || character >= TM_ASCII_END) return 0;
+	const uint8_t *font = SevenSegmentFont::pFontSevenSegptr();
+	return font[character - TM_ASCII_OFFSET];
+}
+
 /*!
 	@brief set the TM comm delay.
 	@param CommDelay The TM comm delay in uS
@@ -181,27 +224,20 @@ rdlib::Return_Codes_e TM1638plus_common::displayClose(void)
 	uint8_t ErrorFlag = 0; // Becomes > 0 in event of error
 
 	int GpioStrobeErrorstatus = 0;
-	int GpioClockErrorstatus = 0;
-	int GpioDataErrorstatus = 0;
+	int GpioBusErrorstatus = 0;
 	int GpioCloseStatus = 0;
 
 	GpioStrobeErrorstatus = Display_GPIO_FREE_CS;
-	GpioClockErrorstatus =  Display_GPIO_FREE_CLK;
-	GpioDataErrorstatus =   Display_GPIO_FREE_SDATA;
+	GpioBusErrorstatus =  _bus.release();
 
 	if (GpioStrobeErrorstatus < 0 )
 	{
 		fprintf(stderr,"Error :: Can't Free STB GPIO (%s)\n", lguErrorText(GpioStrobeErrorstatus));
 		ErrorFlag = 2;
 	}
-	if (GpioClockErrorstatus < 0 )
-	{
-		fprintf(stderr,"Error :: Can't Free CLK GPIO t (%s)\n", lguErrorText(GpioClockErrorstatus));
-		ErrorFlag = 2;
-	}
-	if (GpioDataErrorstatus < 0 )
+	if (GpioBusErrorstatus < 0 )
 	{
-		fprintf(stderr, "Error :: Can't free DATA GPIO (%s)\n", lguErrorText(GpioDataErrorstatus));
+		fprintf(stderr,"Error :: Can't Free CLK and DATA GPIO (%s)\n", lguErrorText(GpioBusErrorstatus));
 		ErrorFlag = 2;
 	}
 
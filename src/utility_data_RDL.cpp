@@ -10,6 +10,8 @@
 */
 
 #include "utility_data_RDL.hpp"
+#include <cstring>
+#include <algorithm>
 
 
 namespace rdlib_maths
@@ -135,6 +137,218 @@ std::ostream& operator<<(std::ostream& os, const std::source_location& location)
 	return os;
 }
 
+/*!
+	@brief Get the logger, worker thread is started on first call
+	@return reference to the one asyncLogger
+*/
+asyncLogger& asyncLogger::instance() {
+	static asyncLogger logger;
+	return logger;
+}
+
+/// @cond
+asyncLogger::asyncLogger() : _cells(std::make_unique<Cell_t[]>(RING_SIZE)) {
+	for (size_t i = 0; i < RING_SIZE; i++)
+		_cells[i].sequence.store(i, std::memory_order_relaxed);
+	_worker = std::thread(&asyncLogger::workerThread, this);
+}
+
+// Writes out everything still queued, then closes the file
+asyncLogger::~asyncLogger() {
+	_stop.store(true, std::memory_order_release);
+	_wakeCond.notify_one();
+	if (_worker.joinable()) _worker.join();
+}
+/// @endcond
+
+/*!
+	@brief Queue a record for the log file, never blocks
+	@param record text of record, truncated at RECORD_SIZE chars
+	@return true if queued or counted as a repeat, false if ring was full and record dropped
+	@details Safe to call from any thread. Time stamp is taken here.
+*/
+bool asyncLogger::submit(std::string_view record) {
+	// Identical records in a burst, e.g. a display off the bus, are only counted
+	auto now = std::chrono::system_clock::now();
+	int64_t nowTicks = now.time_since_epoch().count();
+	size_t hash = std::hash<std::string_view>{}(record);
+	if (hash == _lastHash.load(std::memory_order_relaxed) &&
+		nowTicks - _lastHashTime.load(std::memory_order_relaxed) <
+		std::chrono::duration_cast<std::chrono::system_clock::duration>(REPEAT_WINDOW).count()) {
+		_repeatPending.fetch_add(1, std::memory_order_relaxed);
+		_suppressedCount.fetch_add(1, std::memory_order_relaxed);
+		return true;
+	}
+	_lastHash.store(hash, std::memory_order_relaxed);
+	_lastHashTime.store(nowTicks, std::memory_order_relaxed);
+
+	size_t pos = _enqueuePos.load(std::memory_order_relaxed);
+	Cell_t* cell;
+	for (;;) {
+		cell = &_cells[pos & (RING_SIZE - 1)];
+		size_t seq = cell->sequence.load(std::memory_order_acquire);
+		intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+		if (diff == 0) {
+			if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+				break;
+		} else if (diff < 0) {
+			_droppedCount.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		} else {
+			pos = _enqueuePos.load(std::memory_order_relaxed);
+		}
+	}
+	cell->record.time = now;
+	cell->record.repeatsBefore = _repeatPending.exchange(0, std::memory_order_relaxed);
+	cell->record.length = static_cast<uint16_t>(std::min(record.size(), RECORD_SIZE));
+	std::memcpy(cell->record.text, record.data(), cell->record.length);
+	cell->sequence.store(pos + 1, std::memory_order_release);
+	// Worker drains on a timer, only wake it early when the ring is filling up
+	uint64_t queued = _acceptedCount.fetch_add(1, std::memory_order_relaxed) + 1
+		- _writtenCount.load(std::memory_order_relaxed);
+	if (queued == RING_SIZE / 2) _wakeCond.notify_one();
+	return true;
+}
+
+/*!
+	@brief Wait until all records queued so far are written to the log file
+	@details Blocks the caller, for use at shutdown or in tests, not in draw loops.
+*/
+void asyncLogger::flush() {
+	uint64_t target = _acceptedCount.load(std::memory_order_acquire);
+	while (_writtenCount.load(std::memory_order_acquire) < target) {
+		_wakeCond.notify_one();
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+}
+
+/*!
+	@brief Get the number of records dropped because the ring was full
+	@return dropped count
+*/
+uint32_t asyncLogger::getDroppedCount() const {
+	return _droppedCount.load(std::memory_order_relaxed);
+}
+
+/*!
+	@brief Get the number of records merged into a repeat count
+	@return suppressed count
+*/
+uint32_t asyncLogger::getSuppressedCount() const {
+	return _suppressedCount.load(std::memory_order_relaxed);
+}
+
+/// @cond
+
+// Single consumer pop, worker thread only
+bool asyncLogger::tryPop(Record_t& record) {
+	size_t pos = _dequeuePos.load(std::memory_order_relaxed);
+	Cell_t& cell = _cells[pos & (RING_SIZE - 1)];
+	if (cell.sequence.load(std::memory_order_acquire) != pos + 1)
+		return false;
+	record.time = cell.record.time;
+	record.repeatsBefore = cell.record.repeatsBefore;
+	record.length = cell.record.length;
+	std::memcpy(record.text, cell.record.text, record.length);
+	cell.sequence.store(pos + RING_SIZE, std::memory_order_release);
+	_dequeuePos.store(pos + 1, std::memory_order_relaxed);
+	return true;
+}
+
+// Worker thread, drains the ring every BATCH_INTERVAL and writes one batch per wake up
+void asyncLogger::workerThread() {
+	std::string batch;
+	Record_t record;
+	bool stopping = false;
+	while (!stopping) {
+		{
+			std::unique_lock<std::mutex> lock(_wakeMutex);
+			_wakeCond.wait_for(lock, BATCH_INTERVAL);
+		}
+		stopping = _stop.load(std::memory_order_acquire);
+		uint64_t taken = 0;
+		while (tryPop(record)) {
+			appendRepeats(batch, record.repeatsBefore, record.time);
+			appendRecord(batch, record.time, std::string_view(record.text, record.length));
+			taken++;
+		}
+		// Close off a run of repeats once the burst has ended
+		auto now = std::chrono::system_clock::now();
+		int64_t sinceLast = now.time_since_epoch().count() - _lastHashTime.load(std::memory_order_relaxed);
+		if (stopping || sinceLast >= std::chrono::duration_cast<std::chrono::system_clock::duration>(REPEAT_WINDOW).count()) {
+			appendRepeats(batch, _repeatPending.exchange(0, std::memory_order_relaxed), now);
+		}
+		uint32_t dropped = _droppedCount.load(std::memory_order_relaxed);
+		if (dropped != _droppedReported) {
+			std::ostringstream note;
+			note << "Info: Log queue full, " << (dropped - _droppedReported) << " records dropped\n";
+			appendRecord(batch, std::chrono::system_clock::now(), note.view());
+			_droppedReported = dropped;
+		}
+		if (!batch.empty()) writeBatch(batch);
+		_writtenCount.fetch_add(taken, std::memory_order_release);
+	}
+	if (_file) fclose(_file);
+}
+
+// Formats one record with its time stamp into the batch
+void asyncLogger::appendRecord(std::string& batch, std::chrono::system_clock::time_point time, std::string_view text) {
+	std::time_t timeT = std::chrono::system_clock::to_time_t(time);
+	std::tm timeLocal{};
+	localtime_r(&timeT, &timeLocal);
+	char stamp[32];
+	size_t len = std::strftime(stamp, sizeof(stamp), "[%Y-%m-%d %H:%M:%S]\n", &timeLocal);
+	batch.append(stamp, len);
+	batch.append(text);
+	batch.append("-----------------------------\n");
+}
+
+// Writes the repeat count of the previous record, if any
+void asyncLogger::appendRepeats(std::string& batch, uint32_t repeats, std::chrono::system_clock::time_point time) {
+	if (repeats == 0) return;
+	std::ostringstream note;
+	note << "Info: Previous entry repeated " << repeats << " more times\n";
+	appendRecord(batch, time, note.view());
+}
+
+// Writes the batch to the log file, opening and rotating it as needed
+void asyncLogger::writeBatch(std::string& batch) {
+	std::string path = rdlib_config::getErrorLogPath();
+	uintmax_t maxBytes = rdlib_config::getErrorLogMaxBytes();
+	if (_file && path != _filePath) {
+		fclose(_file);
+		_file = nullptr;
+	}
+	if (_file && maxBytes > 0 && _fileBytes + batch.size() > maxBytes && _fileBytes > 0) {
+		fclose(_file);
+		_file = nullptr;
+		std::error_code ec;
+		std::filesystem::rename(path, path + ".1", ec);
+	}
+	if (!_file) {
+		_file = fopen(path.c_str(), "a");
+		if (!_file) {
+			if (!_openFailReported) {
+				std::cerr << "Failed to open log file: " << path << "\n";
+				perror("Error reason"); // Print system error message
+				_openFailReported = true;
+			}
+			batch.clear();
+			return;
+		}
+		_openFailReported = false;
+		_filePath = path;
+		std::error_code ec;
+		_fileBytes = std::filesystem::file_size(path, ec);
+		if (ec) _fileBytes = 0;
+	}
+	fwrite(batch.data(), 1, batch.size(), _file);
+	fflush(_file);
+	_fileBytes += batch.size();
+	batch.clear();
+}
+/// @endcond
+
 }
 
 namespace rdlib_config 
@@ -143,16 +357,18 @@ namespace rdlib_config
 bool LOGGING_ENABLED = false; /**< is logging enabled ? */
 bool  DEBUG_ENABLED = false; /**< is global debug enabled ? */
 std::string ERROR_LOG_PATH = "/tmp/error.log"; /**< path to the log file */
+uintmax_t ERROR_LOG_MAX_BYTES = 1024 * 1024; /**< log file rotated past this size, 0 = never */
 
 /*!
  * @brief This function loads the config file into program
  * @details if config file does not exist it creates it 
  * at ($HOME)/.config/rdlib_config/config.cfg.
  * if ($HOME) not set uses pwd. Defaults debug and logging
- * settings to false. config file sets 3 settings 
+ * settings to false. config file sets 4 settings 
  * -# LOGGING_ENABLED=false
  * -# DEBUG_ENABLED=false
  * -# ERROR_LOG_PATH="/tmp/error.log"
+ * -# ERROR_LOG_MAX_BYTES=1048576 , optional, 0 disables rotation
  */
 void loadConfig() {
 	
@@ -173,6 +389,7 @@ void loadConfig() {
 			newFile << "LOGGING_ENABLED=false\n";
 			newFile << "DEBUG_ENABLED=false\n";
 			newFile << "ERROR_LOG_PATH=/tmp/rdlib_log.log\n";
+			newFile << "ERROR_LOG_MAX_BYTES=1048576\n";
 		}
 		configFile.open(configPath);
 	}
@@ -191,6 +408,8 @@ void loadConfig() {
 				DEBUG_ENABLED = (value == "true");
 			} else if (key == "ERROR_LOG_PATH") {
 				ERROR_LOG_PATH = value;
+			} else if (key == "ERROR_LOG_MAX_BYTES") {
+				ERROR_LOG_MAX_BYTES = std::strtoull(value.c_str(), nullptr, 10);
 			}
 		}
 	}
@@ -217,5 +436,12 @@ bool isDebugEnabled() {
 std::string getErrorLogPath() {
 		return rdlib_config::ERROR_LOG_PATH;
 	}
+/*!
+ * @brief retrieve the log file size at which it is rotated to <path>.1
+ * @return size in bytes, 0 for no rotation
+ */
+uintmax_t getErrorLogMaxBytes() {
+		return rdlib_config::ERROR_LOG_MAX_BYTES;
+	}
 
 }